@@ -34,6 +34,50 @@
 #define AIW_HX711_SCALE 1000.0f
 #endif
 
+#ifndef AIW_HX711_READ_MODE
+#define AIW_HX711_READ_MODE 1
+#endif
+
+#ifndef AIW_HX711_DOUT2_PIN
+#define AIW_HX711_DOUT2_PIN -1
+#endif
+
+#ifndef AIW_HX711_DOUT3_PIN
+#define AIW_HX711_DOUT3_PIN -1
+#endif
+
+#ifndef AIW_HX711_DOUT4_PIN
+#define AIW_HX711_DOUT4_PIN -1
+#endif
+
+#ifndef AIW_HX711_RATE_PIN
+#define AIW_HX711_RATE_PIN -1
+#endif
+
+#ifndef AIW_HX711_RATE
+#define AIW_HX711_RATE 10
+#endif
+
+#ifndef AIW_HX711_GAIN
+#define AIW_HX711_GAIN 128
+#endif
+
+#ifndef AIW_DISPLAY_DMA
+#define AIW_DISPLAY_DMA 1
+#endif
+
+#ifndef AIW_DISPLAY_SPI_HZ
+#define AIW_DISPLAY_SPI_HZ 40000000
+#endif
+
+#ifndef AIW_DISPLAY_FRAMEBUFFER
+#define AIW_DISPLAY_FRAMEBUFFER 1
+#endif
+
+#ifndef AIW_SCREEN_SNAPSHOTS
+#define AIW_SCREEN_SNAPSHOTS 1
+#endif
+
 #ifndef AIW_PRINTER_TX_PIN
 #define AIW_PRINTER_TX_PIN 41
 #endif
@@ -134,14 +178,25 @@
 #endif
 
 namespace aiw::config {
-static const char *WifiSsid = AIW_WIFI_SSID;
-static const char *WifiPassword = AIW_WIFI_PASSWORD;
-static const char *BackendBaseUrl = AIW_BACKEND_BASE_URL;
-static const char *DeviceId = AIW_DEVICE_ID;
-static const char *DeviceName = AIW_DEVICE_NAME;
+static const char *const WifiSsid = AIW_WIFI_SSID;
+static const char *const WifiPassword = AIW_WIFI_PASSWORD;
+static const char *const BackendBaseUrl = AIW_BACKEND_BASE_URL;
+static const char *const DeviceId = AIW_DEVICE_ID;
+static const char *const DeviceName = AIW_DEVICE_NAME;
 static const int Hx711DoutPin = AIW_HX711_DOUT_PIN;
 static const int Hx711SckPin = AIW_HX711_SCK_PIN;
 static constexpr float Hx711Scale = AIW_HX711_SCALE;
+static const uint8_t Hx711ReadMode = (uint8_t)AIW_HX711_READ_MODE;
+static const int Hx711Dout2Pin = AIW_HX711_DOUT2_PIN;
+static const int Hx711Dout3Pin = AIW_HX711_DOUT3_PIN;
+static const int Hx711Dout4Pin = AIW_HX711_DOUT4_PIN;
+static const int Hx711RatePin = AIW_HX711_RATE_PIN;
+static const int Hx711Rate = AIW_HX711_RATE;
+static const int Hx711Gain = AIW_HX711_GAIN;
+static const bool DisplayDma = (AIW_DISPLAY_DMA != 0);
+static const uint32_t DisplaySpiHz = (uint32_t)AIW_DISPLAY_SPI_HZ;
+static const bool DisplayFramebuffer = (AIW_DISPLAY_FRAMEBUFFER != 0);
+static const bool ScreenSnapshots = (AIW_SCREEN_SNAPSHOTS != 0);
 static const int PrinterTxPin = AIW_PRINTER_TX_PIN;
 static const int PrinterRxPin = AIW_PRINTER_RX_PIN;
 static const int PrinterBaud = AIW_PRINTER_BAUD;
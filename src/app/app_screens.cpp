@@ -0,0 +1,65 @@
+#include "app/app_screens.h"
+
+#include <stdio.h>
+
+#include "app/app_config.h"
+
+namespace aiw {
+
+using namespace ui;
+
+AppScreens::AppScreens(SevenSeg &seg, QrRenderer &qr, int heightCm)
+    : heightBackdrop(ScreenLayer::HeightPicker),
+      weighBackdrop(ScreenLayer::Weigh),
+      payBackdrop(ScreenLayer::Pay),
+      frameBackdrop(ScreenLayer::Frame),
+      heightSlider(HeightValueX, HeightValueY, HeightValueW, HeightValueH, HeightSlider, heightCm),
+      heightValue(seg, 108, 52, 3, 5, ColorBlack, ColorWhite),
+      heightNumber(seg, 10, 10, 3, 3, ColorGray, ColorWhite),
+      weightNumber(seg, 100, 6, 7, 4, ColorBlack, ColorWhite),
+      tareButton(WeighTareX, WeighBtnY, WeighTareW, WeighBtnH, 0xE7FF, kZhTare),
+      qrView(qr, QrMargin, HeaderH + QrMargin, ScreenW - 2 * QrMargin, FooterY - HeaderH - 2 * QrMargin, ColorBlack, ColorWhite),
+      statusLabel(StatusLabelX, StatusLabelY, 276, 14, LabelFont::Mono5x7, 2, ColorGray, ColorWhite),
+      heightScreen(heightBackdrop),
+      weighScreen(weighBackdrop),
+      payScreen(payBackdrop),
+      statusScreen(frameBackdrop),
+      all{&heightScreen, &weighScreen, &payScreen, &statusScreen} {
+  heightScreen.add(heightSlider);
+  heightScreen.add(heightValue);
+  weighScreen.add(tareButton);
+  weighScreen.add(heightNumber);
+  weighScreen.add(weightNumber);
+  payScreen.add(qrView);
+  statusScreen.add(statusLabel);
+  statusScreen.add(heightNumber);
+  statusScreen.add(weightNumber);
+  setSnapshots(config::ScreenSnapshots);
+}
+
+void AppScreens::setSnapshots(bool on) {
+  for (WidgetScreen *s : all) s->backdrop().setSnapshot(on);
+}
+
+void AppScreens::setFullRepaint(bool on) {
+  for (WidgetScreen *s : all) s->setFullRepaint(on);
+}
+
+void AppScreens::setHeight(int cm) {
+  char buf[8];
+  snprintf(buf, sizeof(buf), "%d", cm);
+  heightSlider.setValue(cm);
+  heightValue.setText(buf);
+}
+
+void AppScreens::setReadouts(const char *height, const char *weight) {
+  heightNumber.setText(height);
+  weightNumber.setText(weight);
+}
+
+const char *AppScreens::name(int index) {
+  static const char *const names[Count] = {"height", "weigh", "pay", "status"};
+  return index >= 0 && index < Count ? names[index] : "?";
+}
+
+}  // namespace aiw
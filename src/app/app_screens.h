@@ -0,0 +1,44 @@
+#pragma once
+
+#include "app/qr_renderer.h"
+#include "app/seven_seg.h"
+#include "app/widgets.h"
+
+namespace aiw {
+
+// The firmware's screens and their widgets, declared once for main.cpp and the host
+// display simulator.
+struct AppScreens {
+  static constexpr int Count = 4;
+
+  AppScreens(SevenSeg &seg, QrRenderer &qr, int heightCm);
+  void setSnapshots(bool on);
+  bool snapshots() const { return heightBackdrop.snapshot(); }
+  void setFullRepaint(bool on);
+  // Slider and value of the height picker.
+  void setHeight(int cm);
+  // Header readouts of the weighing and status screens.
+  void setReadouts(const char *height, const char *weight);
+  static const char *name(int index);
+
+  ImageWidget heightBackdrop;
+  ImageWidget weighBackdrop;
+  ImageWidget payBackdrop;
+  ImageWidget frameBackdrop;
+
+  SliderWidget heightSlider;
+  NumberWidget heightValue;
+  NumberWidget heightNumber;
+  NumberWidget weightNumber;
+  ButtonWidget tareButton;
+  QrWidget qrView;
+  LabelWidget statusLabel;
+
+  WidgetScreen heightScreen;
+  WidgetScreen weighScreen;
+  WidgetScreen payScreen;
+  WidgetScreen statusScreen;
+  WidgetScreen *const all[Count];
+};
+
+}  // namespace aiw
@@ -0,0 +1,68 @@
+#include "app/async_tare.h"
+
+namespace aiw {
+
+void AsyncTare::start(int samples, int32_t motionCounts, uint8_t maxAttempts) {
+  samples_ = samples < 1 ? 1 : samples;
+  motionCounts_ = motionCounts < 1 ? 1 : motionCounts;
+  maxAttempts_ = maxAttempts < 1 ? 1 : maxAttempts;
+  attempts_ = 1;
+  lastRange_ = 0;
+  state_ = TareState::Collecting;
+  restartWindow();
+}
+
+void AsyncTare::cancel() {
+  if (state_ == TareState::Collecting) state_ = TareState::Rejected;
+}
+
+void AsyncTare::restartWindow() {
+  count_ = 0;
+  sum_ = 0;
+}
+
+bool AsyncTare::push(int32_t raw) {
+  if (state_ != TareState::Collecting) return false;
+  if (count_ == 0) {
+    min_ = raw;
+    max_ = raw;
+  } else {
+    if (raw < min_) min_ = raw;
+    if (raw > max_) max_ = raw;
+  }
+  sum_ += raw;
+  count_++;
+  lastRange_ = max_ - min_;
+
+  if (lastRange_ > motionCounts_) {
+    if (attempts_ >= maxAttempts_) {
+      state_ = TareState::Rejected;
+      return true;
+    }
+    attempts_++;
+    restartWindow();
+    return false;
+  }
+  if (count_ < samples_) return false;
+  offset_ = (int32_t)(sum_ / count_);
+  state_ = TareState::Done;
+  return true;
+}
+
+uint8_t AsyncTare::progress() const {
+  if (state_ == TareState::Done) return 100;
+  if (state_ != TareState::Collecting) return 0;
+  return (uint8_t)(count_ * 100 / samples_);
+}
+
+const char *tareStateName(TareState state) {
+  switch (state) {
+    case TareState::Idle: return "idle";
+    case TareState::Collecting: return "collecting";
+    case TareState::Done: return "done";
+    case TareState::Rejected: return "rejected";
+    default: return "?";
+  }
+}
+
+}  // namespace aiw
@@ -0,0 +1,47 @@
+#pragma once
+
+#include <stdint.h>
+
+namespace aiw {
+
+enum class TareState : uint8_t {
+  Idle = 0,
+  Collecting = 1,
+  Done = 2,
+  Rejected = 3,
+};
+
+// Zeroes from the live conversion stream instead of blocking on reads. A window
+// whose range exceeds motionCounts is thrown away and collection restarts.
+class AsyncTare {
+public:
+  void start(int samples, int32_t motionCounts, uint8_t maxAttempts);
+  void cancel();
+  bool push(int32_t raw);
+
+  TareState state() const { return state_; }
+  bool busy() const { return state_ == TareState::Collecting; }
+  uint8_t progress() const;
+  uint8_t attempts() const { return attempts_; }
+  int32_t offset() const { return offset_; }
+  int32_t lastRange() const { return lastRange_; }
+
+private:
+  void restartWindow();
+
+  TareState state_ = TareState::Idle;
+  int samples_ = 30;
+  int32_t motionCounts_ = 200;
+  uint8_t maxAttempts_ = 3;
+  uint8_t attempts_ = 0;
+  int count_ = 0;
+  int64_t sum_ = 0;
+  int32_t min_ = 0;
+  int32_t max_ = 0;
+  int32_t offset_ = 0;
+  int32_t lastRange_ = 0;
+};
+
+const char *tareStateName(TareState state);
+
+}  // namespace aiw
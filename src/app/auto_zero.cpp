@@ -0,0 +1,110 @@
+#include "app/auto_zero.h"
+
+namespace aiw {
+
+AutoZeroConfig makeAutoZeroConfig(float countsPerKg, float stepKg) {
+  AutoZeroConfig cfg;
+  if (countsPerKg <= 0.0f || stepKg <= 0.0f) return cfg;
+  float step = countsPerKg * stepKg;
+  cfg.bandCounts = (int32_t)(step * 2.0f + 0.5f);
+  cfg.stableRangeCounts = (int32_t)(step + 0.5f);
+  cfg.maxStepCounts = (int32_t)(step * 0.5f + 0.5f);
+  cfg.limitCounts = (int32_t)(step * 20.0f + 0.5f);
+  if (cfg.stableRangeCounts < 1) cfg.stableRangeCounts = 1;
+  if (cfg.maxStepCounts < 1) cfg.maxStepCounts = 1;
+  return cfg;
+}
+
+void AutoZeroTracker::configure(const AutoZeroConfig &cfg) {
+  cfg_ = cfg;
+  if (cfg_.windowMs < 100) cfg_.windowMs = 100;
+  if (cfg_.confirmWindows < 1) cfg_.confirmWindows = 1;
+  if (cfg_.minSamples < 1) cfg_.minSamples = 1;
+  windowOpen_ = false;
+  emptyRun_ = 0;
+}
+
+void AutoZeroTracker::setEnabled(bool on) {
+  enabled_ = on;
+  windowOpen_ = false;
+  emptyRun_ = 0;
+}
+
+void AutoZeroTracker::reset() {
+  stats_ = AutoZeroStats{};
+  windowOpen_ = false;
+  emptyRun_ = 0;
+}
+
+void AutoZeroTracker::restartWindow(uint32_t nowMs) {
+  windowOpen_ = true;
+  windowStartMs_ = nowMs;
+  sum_ = 0;
+  count_ = 0;
+}
+
+bool AutoZeroTracker::push(int32_t delta, uint32_t nowMs, int32_t &correction) {
+  correction = 0;
+  if (!enabled_) return false;
+  if (!windowOpen_) restartWindow(nowMs);
+
+  bool applied = false;
+  if (nowMs - windowStartMs_ >= cfg_.windowMs) {
+    applied = closeWindow(correction);
+    restartWindow(nowMs);
+  }
+
+  if (count_ == 0) {
+    min_ = delta;
+    max_ = delta;
+  } else {
+    if (delta < min_) min_ = delta;
+    if (delta > max_) max_ = delta;
+  }
+  sum_ += delta;
+  count_++;
+  return applied;
+}
+
+bool AutoZeroTracker::closeWindow(int32_t &correction) {
+  if (count_ < cfg_.minSamples) {
+    emptyRun_ = 0;
+    return false;
+  }
+  int32_t mean = (int32_t)(sum_ / count_);
+  int32_t absMean = mean < 0 ? -mean : mean;
+  if (absMean > cfg_.bandCounts) {
+    stats_.loadedWindows++;
+    emptyRun_ = 0;
+    return false;
+  }
+  if (max_ - min_ > cfg_.stableRangeCounts) {
+    stats_.motionWindows++;
+    emptyRun_ = 0;
+    return false;
+  }
+  stats_.emptyWindows++;
+  if (emptyRun_ < 255) emptyRun_++;
+  if (emptyRun_ < cfg_.confirmWindows) return false;
+
+  int32_t step = mean;
+  if (step > cfg_.maxStepCounts) step = cfg_.maxStepCounts;
+  if (step < -cfg_.maxStepCounts) step = -cfg_.maxStepCounts;
+  int32_t total = stats_.totalCounts + step;
+  if (total > cfg_.limitCounts || total < -cfg_.limitCounts) {
+    stats_.limitHits++;
+    total = total > 0 ? cfg_.limitCounts : -cfg_.limitCounts;
+    step = total - stats_.totalCounts;
+  }
+  if (step == 0) return false;
+
+  stats_.corrections++;
+  stats_.lastStepCounts = step;
+  stats_.totalCounts = total;
+  if (total < stats_.minTotalCounts) stats_.minTotalCounts = total;
+  if (total > stats_.maxTotalCounts) stats_.maxTotalCounts = total;
+  correction = step;
+  return true;
+}
+
+}  // namespace aiw
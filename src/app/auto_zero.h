@@ -0,0 +1,63 @@
+#pragma once
+
+#include <stdint.h>
+
+namespace aiw {
+
+struct AutoZeroConfig {
+  int32_t bandCounts = 200;
+  int32_t stableRangeCounts = 100;
+  uint32_t windowMs = 1000;
+  uint8_t confirmWindows = 2;
+  uint8_t minSamples = 4;
+  int32_t maxStepCounts = 50;
+  int32_t limitCounts = 2000;
+};
+
+AutoZeroConfig makeAutoZeroConfig(float countsPerKg, float stepKg);
+
+struct AutoZeroStats {
+  uint32_t corrections;
+  uint32_t emptyWindows;
+  uint32_t motionWindows;
+  uint32_t loadedWindows;
+  uint32_t limitHits;
+  int32_t lastStepCounts;
+  int32_t totalCounts;
+  int32_t minTotalCounts;
+  int32_t maxTotalCounts;
+};
+
+// Tracks slow zero drift from the raw conversion stream. Each window of samples
+// that is both inside the zero band and quiet counts as "empty"; after
+// confirmWindows in a row, the window mean is fed back as a bounded offset step.
+class AutoZeroTracker {
+public:
+  void configure(const AutoZeroConfig &cfg);
+  const AutoZeroConfig &config() const { return cfg_; }
+
+  void setEnabled(bool on);
+  bool enabled() const { return enabled_; }
+
+  void reset();
+  bool push(int32_t delta, uint32_t nowMs, int32_t &correction);
+
+  const AutoZeroStats &stats() const { return stats_; }
+
+private:
+  void restartWindow(uint32_t nowMs);
+  bool closeWindow(int32_t &correction);
+
+  AutoZeroConfig cfg_;
+  AutoZeroStats stats_{};
+  bool enabled_ = true;
+  bool windowOpen_ = false;
+  uint32_t windowStartMs_ = 0;
+  int64_t sum_ = 0;
+  int32_t count_ = 0;
+  int32_t min_ = 0;
+  int32_t max_ = 0;
+  uint8_t emptyRun_ = 0;
+};
+
+}  // namespace aiw
@@ -0,0 +1,55 @@
+#include "app/boot_profiler.h"
+
+#include <esp_timer.h>
+
+namespace aiw {
+
+int BootProfiler::begin(const char *name) {
+  uint32_t now = (uint32_t)esp_timer_get_time();
+  int id = -1;
+  portENTER_CRITICAL(&mux_);
+  if (count_ < MaxPhases) {
+    id = count_;
+    phases_[id] = BootPhase{name, now, now, false};
+    count_ = count_ + 1;
+  }
+  portEXIT_CRITICAL(&mux_);
+  return id;
+}
+
+void BootProfiler::end(int id) {
+  if (id < 0 || id >= count_) return;
+  uint32_t now = (uint32_t)esp_timer_get_time();
+  portENTER_CRITICAL(&mux_);
+  if (!phases_[id].done) {
+    phases_[id].endUs = now;
+    phases_[id].done = true;
+  }
+  portEXIT_CRITICAL(&mux_);
+}
+
+void BootProfiler::milestone(const char *name) {
+  end(begin(name));
+}
+
+bool BootProfiler::finished(int id) const {
+  if (id < 0 || id >= count_) return true;
+  return phases_[id].done;
+}
+
+int BootProfiler::count() const {
+  return count_;
+}
+
+void BootProfiler::report(Print &out) const {
+  int n = count_;
+  uint32_t now = (uint32_t)esp_timer_get_time();
+  out.printf("boot profile (%d phases, ms since reset)\n", n);
+  for (int i = 0; i < n; ++i) {
+    const BootPhase &p = phases_[i];
+    uint32_t endUs = p.done ? p.endUs : now;
+    out.printf("  %-16s start=%7.1f dur=%7.1f%s\n", p.name, p.startUs / 1000.0f, (endUs - p.startUs) / 1000.0f, p.done ? "" : " (running)");
+  }
+}
+
+}  // namespace aiw
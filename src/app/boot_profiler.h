@@ -0,0 +1,34 @@
+#pragma once
+
+#include <Arduino.h>
+
+namespace aiw {
+
+struct BootPhase {
+  const char *name;
+  uint32_t startUs;
+  uint32_t endUs;
+  bool done;
+};
+
+// Records named boot phases from any task. Times are microseconds since reset,
+// so the report also shows how long the ROM bootloader and Arduino core took.
+class BootProfiler {
+public:
+  static constexpr int MaxPhases = 24;
+
+  int begin(const char *name);
+  void end(int id);
+  void milestone(const char *name);
+
+  bool finished(int id) const;
+  int count() const;
+  void report(Print &out) const;
+
+private:
+  BootPhase phases_[MaxPhases] = {};
+  volatile int count_ = 0;
+  portMUX_TYPE mux_ = portMUX_INITIALIZER_UNLOCKED;
+};
+
+}  // namespace aiw
@@ -0,0 +1,81 @@
+#include "app/display_bench.h"
+
+#include <esp_timer.h>
+
+namespace aiw {
+
+const char *displayBusModeName(DisplayBusMode mode) {
+  switch (mode) {
+    case DisplayBusMode::Blocking: return "blocking";
+    case DisplayBusMode::Dma: return "dma";
+    default: return "?";
+  }
+}
+
+bool runDisplayFillBench(DisplaySt7789 &display, DisplayBusMode mode, uint32_t clockHz, int fills, DisplayBenchResult &out) {
+  out = DisplayBenchResult{};
+  DisplayBusMode prevMode = display.busMode();
+  uint32_t prevHz = display.clockHz();
+  if (!display.setBusMode(mode) || !display.setClockHz(clockHz)) {
+    display.setBusMode(prevMode);
+    display.setClockHz(prevHz);
+    return false;
+  }
+
+  static const uint16_t Colors[] = {0xF800, 0x07E0, 0x001F, 0xFFFF};
+  uint64_t sumUs = 0;
+  uint64_t busyUs = 0;
+  for (int i = 0; i < fills; ++i) {
+    uint64_t wait0 = display.busWaitUs();
+    int64_t t0 = esp_timer_get_time();
+    display.beginWrite();
+    display.clear(Colors[i % 4]);
+    display.endWrite();
+    display.flush();
+    uint32_t us = (uint32_t)(esp_timer_get_time() - t0);
+    uint64_t waited = display.busWaitUs() - wait0;
+    if (out.fills == 0 || us < out.minUs) out.minUs = us;
+    if (us > out.maxUs) out.maxUs = us;
+    sumUs += us;
+    busyUs += us > waited ? us - waited : 0;
+    out.fills++;
+  }
+  if (out.fills > 0) out.avgUs = (uint32_t)(sumUs / (uint64_t)out.fills);
+  if (sumUs > 0) out.busyPct = 100.0f * (float)busyUs / (float)sumUs;
+
+  display.setBusMode(prevMode);
+  display.setClockHz(prevHz);
+  return true;
+}
+
+bool runDisplayPixelBench(DisplaySt7789 &display, bool batchedAddr, int calls, DisplayPixelBenchResult &out) {
+  out = DisplayPixelBenchResult{};
+  if (calls <= 0) return false;
+  bool prevBatched = display.batchedAddr();
+  display.setBatchedAddr(batchedAddr);
+  const int cols = 32;
+
+  display.beginWrite();
+  int64_t t0 = esp_timer_get_time();
+  for (int i = 0; i < calls; ++i) {
+    display.fillRect(i % cols, (i / cols) % 32, 1, 1, (i & 1) ? 0x0000 : 0xFFFF);
+  }
+  display.flush();
+  int64_t walkUs = esp_timer_get_time() - t0;
+
+  t0 = esp_timer_get_time();
+  for (int i = 0; i < calls; ++i) {
+    display.fillRect(0, 0, 1, 1, (i & 1) ? 0x0000 : 0xFFFF);
+  }
+  display.flush();
+  int64_t repeatUs = esp_timer_get_time() - t0;
+  display.endWrite();
+
+  out.calls = calls;
+  out.walkNs = (uint32_t)(walkUs * 1000 / calls);
+  out.repeatNs = (uint32_t)(repeatUs * 1000 / calls);
+  display.setBatchedAddr(prevBatched);
+  return true;
+}
+
+}  // namespace aiw
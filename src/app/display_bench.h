@@ -0,0 +1,34 @@
+#pragma once
+
+#include <Arduino.h>
+
+#include "app/display_st7789.h"
+
+namespace aiw {
+
+struct DisplayBenchResult {
+  int fills = 0;
+  uint32_t minUs = 0;
+  uint32_t maxUs = 0;
+  uint32_t avgUs = 0;
+  // Share of the fill time the calling task was not blocked on the bus.
+  float busyPct = 0.0f;
+};
+
+struct DisplayPixelBenchResult {
+  int calls = 0;
+  // Average cost of a 1x1 fillRect walking rows, the way the glyph renderers draw.
+  uint32_t walkNs = 0;
+  // Average cost of a 1x1 fillRect into the window drawn last.
+  uint32_t repeatNs = 0;
+};
+
+// Full-screen clears in the given mode and clock, timed until the last pixel is out.
+// The previous mode and clock are restored; the screen content is not.
+bool runDisplayFillBench(DisplaySt7789 &display, DisplayBusMode mode, uint32_t clockHz, int fills, DisplayBenchResult &out);
+// Per-pixel fillRect calls in the top-left corner with the window batching on or off,
+// in the current bus mode and clock.
+bool runDisplayPixelBench(DisplaySt7789 &display, bool batchedAddr, int calls, DisplayPixelBenchResult &out);
+const char *displayBusModeName(DisplayBusMode mode);
+
+}  // namespace aiw
@@ -0,0 +1,250 @@
+#include "app/display_list.h"
+
+#include <math.h>
+
+#include "app/mini_font.h"
+#include "app/zh_bitmaps.h"
+#include "app/zh_font_gb1_28_subset.h"
+
+namespace aiw {
+
+void DisplayList::begin(int x, int y, int w, int h, uint16_t bg) {
+  x_ = x;
+  y_ = y;
+  w_ = w > 0 ? w : 0;
+  h_ = h > 0 ? h : 0;
+  bg_ = bg;
+  count_ = 0;
+  overflowed_ = false;
+}
+
+bool DisplayList::push(const DisplayOp &op) {
+  if (count_ >= Capacity) {
+    overflowed_ = true;
+    return false;
+  }
+  ops_[count_++] = op;
+  return true;
+}
+
+static DisplayOp makeOp(DisplayOpKind kind, int x, int y, int w, int h, uint16_t fg, uint16_t bg) {
+  DisplayOp op = {};
+  op.kind = kind;
+  op.x = (int16_t)x;
+  op.y = (int16_t)y;
+  op.w = (int16_t)w;
+  op.h = (int16_t)h;
+  op.fg = fg;
+  op.bg = bg;
+  return op;
+}
+
+bool DisplayList::rect(int x, int y, int w, int h, uint16_t color) {
+  if (w <= 0 || h <= 0) return true;
+  return push(makeOp(DisplayOpKind::Rect, x, y, w, h, color, color));
+}
+
+bool DisplayList::roundRect(int x, int y, int w, int h, int r, uint16_t color) {
+  if (w <= 0 || h <= 0) return true;
+  if (r * 2 > w) r = w / 2;
+  if (r * 2 > h) r = h / 2;
+  DisplayOp op = makeOp(r < 1 ? DisplayOpKind::Rect : DisplayOpKind::RoundRect, x, y, w, h, color, color);
+  op.param = (uint8_t)(r < 1 ? 0 : (r > 255 ? 255 : r));
+  return push(op);
+}
+
+bool DisplayList::bitmap1(int x, int y, int w, int h, const uint8_t *bits, size_t strideBytes, uint16_t fg, uint16_t bg, int scale, bool lsbFirst) {
+  if (!bits || w <= 0 || h <= 0) return true;
+  if (scale < 1) scale = 1;
+  DisplayOp op = makeOp(DisplayOpKind::Bitmap1, x, y, w, h, fg, bg);
+  op.param = (uint8_t)scale;
+  op.lsbFirst = lsbFirst;
+  op.stride = (uint16_t)strideBytes;
+  op.data = bits;
+  return push(op);
+}
+
+bool DisplayList::bitmap4(int x, int y, int w, int h, const uint8_t *data, const uint16_t *palette) {
+  if (!data || !palette || w <= 0 || h <= 0) return true;
+  DisplayOp op = makeOp(DisplayOpKind::Bitmap4, x, y, w, h, 0, 0);
+  op.data = data;
+  op.palette = palette;
+  return push(op);
+}
+
+bool DisplayList::rgb565(int x, int y, int w, int h, const uint16_t *pixels) {
+  if (!pixels || w <= 0 || h <= 0) return true;
+  DisplayOp op = makeOp(DisplayOpKind::Rgb565, x, y, w, h, 0, 0);
+  op.data = pixels;
+  return push(op);
+}
+
+bool DisplayList::text5x7(int x, int y, const char *text, uint16_t fg, uint16_t bg, int scale) {
+  if (!text || !text[0]) return true;
+  if (scale < 1) scale = 1;
+  DisplayOp op = makeOp(DisplayOpKind::Text5x7, x, y, 0, 7 * scale, fg, bg);
+  op.param = (uint8_t)scale;
+  op.data = text;
+  return push(op);
+}
+
+// The render mode is taken now, as drawZhText16 would use it if called here.
+bool DisplayList::zhText16(int x, int y, const char *utf8, uint16_t fg, uint16_t bg) {
+  if (!utf8 || !utf8[0]) return true;
+  DisplayOp op = makeOp(DisplayOpKind::ZhText16, x, y, 0, 16, fg, bg);
+  op.param = zhRenderMode();
+  op.data = utf8;
+  return push(op);
+}
+
+bool DisplayList::zhText28(int x, int y, const char *utf8, uint16_t fg, uint16_t bg) {
+  if (!utf8 || !utf8[0]) return true;
+  DisplayOp op = makeOp(DisplayOpKind::ZhText28, x, y, 0, 0, fg, bg);
+  op.data = utf8;
+  return push(op);
+}
+
+void DisplayList::rasterize(int y0, int rows, uint16_t *out, size_t stride, bool swapBytes) const {
+  for (int r = 0; r < rows; ++r) {
+    uint16_t *row = out + (size_t)r * stride;
+    for (int c = 0; c < w_; ++c) row[c] = bg_;
+    int y = y0 + r;
+    for (int i = 0; i < count_; ++i) rasterizeOp(ops_[i], y, row);
+    if (swapBytes) {
+      for (int c = 0; c < w_; ++c) row[c] = (uint16_t)((row[c] >> 8) | (row[c] << 8));
+    }
+  }
+}
+
+// Writes screen columns [x0, x1) of one region row, clipped to the region.
+static void span(uint16_t *row, int regionX, int regionW, int x0, int x1, uint16_t color) {
+  x0 -= regionX;
+  x1 -= regionX;
+  if (x0 < 0) x0 = 0;
+  if (x1 > regionW) x1 = regionW;
+  for (int c = x0; c < x1; ++c) row[c] = color;
+}
+
+void DisplayList::rasterizeOp(const DisplayOp &op, int y, uint16_t *row) const {
+  int dy = y - op.y;
+  if (dy < 0) return;
+  switch (op.kind) {
+    case DisplayOpKind::Rect:
+      if (dy < op.h) span(row, x_, w_, op.x, op.x + op.w, op.fg);
+      return;
+
+    // Same corner spans as a row-by-row fillRoundRect.
+    case DisplayOpKind::RoundRect: {
+      if (dy >= op.h) return;
+      int r = op.param;
+      int d = dy < r ? dy : (dy >= op.h - r ? op.h - 1 - dy : -1);
+      int sx = 0;
+      if (d >= 0) {
+        float fy = (float)d + 0.5f;
+        float fr = (float)r;
+        sx = r - (int)floorf(sqrtf(fr * fr - fy * fy));
+      }
+      if (op.w - 2 * sx > 0) span(row, x_, w_, op.x + sx, op.x + op.w - sx, op.fg);
+      return;
+    }
+
+    case DisplayOpKind::Bitmap1: {
+      int scale = op.param;
+      if (dy >= op.h * scale) return;
+      const uint8_t *bits = (const uint8_t *)op.data + (size_t)(dy / scale) * op.stride;
+      int c0 = x_ - op.x > 0 ? x_ - op.x : 0;
+      int c1 = op.w * scale < x_ + w_ - op.x ? op.w * scale : x_ + w_ - op.x;
+      for (int c = c0; c < c1; ++c) {
+        int sc = c / scale;
+        uint8_t mask = op.lsbFirst ? (uint8_t)(0x01u << (sc & 7)) : (uint8_t)(0x80u >> (sc & 7));
+        row[op.x + c - x_] = (bits[sc >> 3] & mask) ? op.fg : op.bg;
+      }
+      return;
+    }
+
+    case DisplayOpKind::Bitmap4: {
+      if (dy >= op.h) return;
+      const uint8_t *data = (const uint8_t *)op.data;
+      int c0 = x_ - op.x > 0 ? x_ - op.x : 0;
+      int c1 = op.w < x_ + w_ - op.x ? op.w : x_ + w_ - op.x;
+      for (int c = c0; c < c1; ++c) {
+        size_t idx = (size_t)dy * (size_t)op.w + (size_t)c;
+        uint8_t b = data[idx / 2];
+        row[op.x + c - x_] = op.palette[(idx & 1) ? (b & 0x0Fu) : (b >> 4)];
+      }
+      return;
+    }
+
+    case DisplayOpKind::Rgb565: {
+      if (dy >= op.h) return;
+      const uint16_t *px = (const uint16_t *)op.data + (size_t)dy * (size_t)op.w;
+      int c0 = x_ - op.x > 0 ? x_ - op.x : 0;
+      int c1 = op.w < x_ + w_ - op.x ? op.w : x_ + w_ - op.x;
+      for (int c = c0; c < c1; ++c) row[op.x + c - x_] = px[c];
+      return;
+    }
+
+    case DisplayOpKind::Text5x7: {
+      int scale = op.param;
+      if (dy >= op.h) return;
+      int gr = dy / scale;
+      int cx = op.x;
+      for (const char *p = (const char *)op.data; *p && cx < x_ + w_; ++p, cx += 6 * scale) {
+        if (cx + 5 * scale <= x_) continue;
+        uint8_t rows[7];
+        uint8_t bits = glyph5x7(*p, rows) ? rows[gr] : 0;
+        for (int col = 0; col < 5; ++col) {
+          span(row, x_, w_, cx + col * scale, cx + (col + 1) * scale, (bits & (0x10u >> col)) ? op.fg : op.bg);
+        }
+      }
+      return;
+    }
+
+    case DisplayOpKind::ZhText16: {
+      if (dy >= 16) return;
+      size_t i = 0;
+      uint32_t cp = 0;
+      int cx = op.x;
+      while (cx < x_ + w_ && utf8Next((const char *)op.data, i, cp)) {
+        const MonoGlyph16 *g = findZhGlyph(cp);
+        if (!g) {
+          cx += 8;
+          continue;
+        }
+        uint8_t a0 = g->rows[dy * 2 + 0];
+        uint8_t a1 = g->rows[dy * 2 + 1];
+        uint16_t bits = (op.param & 0x01u) ? (uint16_t)((a1 << 8) | a0) : (uint16_t)((a0 << 8) | a1);
+        for (int c = 0; c < 16; ++c) {
+          int byteBit = c & 7;
+          uint8_t b = (uint8_t)(c < 8 ? bits >> 8 : bits);
+          bool on = (op.param & 0x02u) ? (b & (0x01u << byteBit)) != 0 : (b & (0x80u >> byteBit)) != 0;
+          span(row, x_, w_, cx + c, cx + c + 1, on ? op.fg : op.bg);
+        }
+        cx += 16;
+      }
+      return;
+    }
+
+    // Coverage below 4/15 is background, as in drawZhText28.
+    case DisplayOpKind::ZhText28: {
+      size_t i = 0;
+      uint32_t cp = 0;
+      int cx = op.x;
+      while (cx < x_ + w_ && utf8Next((const char *)op.data, i, cp)) {
+        const ZhGlyph28 *g = findZhGlyph28(cp);
+        if (g && dy < g->box_h) {
+          for (int c = 0; c < g->box_w; ++c) {
+            size_t idx = (size_t)dy * g->box_w + (size_t)c;
+            uint8_t b = g->data[idx / 2];
+            uint8_t v = (idx & 1) ? (b & 0x0Fu) : (b >> 4);
+            span(row, x_, w_, cx + c, cx + c + 1, v >= 4 ? op.fg : op.bg);
+          }
+        }
+        cx += 28;
+      }
+      return;
+    }
+  }
+}
+
+}  // namespace aiw
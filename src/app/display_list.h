@@ -0,0 +1,84 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+namespace aiw {
+
+enum class DisplayOpKind : uint8_t {
+  Rect,
+  RoundRect,
+  Bitmap1,
+  Bitmap4,
+  Rgb565,
+  Text5x7,
+  ZhText16,
+  ZhText28,
+};
+
+struct DisplayOp {
+  DisplayOpKind kind;
+  // Corner radius for RoundRect, pixel scale for Bitmap1 and Text5x7, the zh render
+  // mode for ZhText16.
+  uint8_t param;
+  bool lsbFirst;
+  int16_t x;
+  int16_t y;
+  int16_t w;
+  int16_t h;
+  uint16_t fg;
+  uint16_t bg;
+  uint16_t stride;
+  // Bitmap bits, pixels or the text; never copied.
+  const void *data;
+  const uint16_t *palette;
+};
+
+// Primitives recorded in painter's order and rasterized a band of rows at a time, so
+// every pixel of the region is produced once and sent once. Area the ops leave
+// uncovered gets the region background. Bitmaps, palettes and strings are referenced,
+// not copied, and must outlive rasterize(). Arduino-free, so screens can be rendered
+// on the host too.
+class DisplayList {
+public:
+  static constexpr int Capacity = 48;
+
+  void begin(int x, int y, int w, int h, uint16_t bg);
+
+  // False once the list is full; later ops are dropped and overflowed() turns true.
+  bool rect(int x, int y, int w, int h, uint16_t color);
+  bool roundRect(int x, int y, int w, int h, int r, uint16_t color);
+  bool bitmap1(int x, int y, int w, int h, const uint8_t *bits, size_t strideBytes, uint16_t fg, uint16_t bg, int scale = 1, bool lsbFirst = false);
+  bool bitmap4(int x, int y, int w, int h, const uint8_t *data, const uint16_t *palette);
+  bool rgb565(int x, int y, int w, int h, const uint16_t *pixels);
+  // Same layout and glyphs as drawText5x7 / drawZhText16 / drawZhText28.
+  bool text5x7(int x, int y, const char *text, uint16_t fg, uint16_t bg, int scale = 1);
+  bool zhText16(int x, int y, const char *utf8, uint16_t fg, uint16_t bg);
+  bool zhText28(int x, int y, const char *utf8, uint16_t fg, uint16_t bg);
+
+  int x() const { return x_; }
+  int y() const { return y_; }
+  int width() const { return w_; }
+  int height() const { return h_; }
+  int size() const { return count_; }
+  bool overflowed() const { return overflowed_; }
+
+  // Writes region rows [y0, y0 + rows) to out, row r at out + r * stride. swapBytes
+  // gives the big-endian order the panel takes.
+  void rasterize(int y0, int rows, uint16_t *out, size_t stride, bool swapBytes) const;
+
+private:
+  bool push(const DisplayOp &op);
+  void rasterizeOp(const DisplayOp &op, int y, uint16_t *row) const;
+
+  int x_ = 0;
+  int y_ = 0;
+  int w_ = 0;
+  int h_ = 0;
+  uint16_t bg_ = 0;
+  int count_ = 0;
+  bool overflowed_ = false;
+  DisplayOp ops_[Capacity];
+};
+
+}  // namespace aiw
@@ -1,10 +1,41 @@
 #include "app/display_st7789.h"
 
+#include <esp_heap_caps.h>
+#include <esp_timer.h>
+#include <soc/gpio_struct.h>
+
 namespace aiw {
 
 static constexpr int Xoff = 0;
 static constexpr int Yoff = 0;
-static constexpr uint32_t SpiHz = 10000000;
+static constexpr spi_host_device_t DisplaySpiHost = SPI2_HOST;
+
+// Straight to the set/clear registers: digitalWrite costs about a microsecond per edge,
+// which adds up when every glyph pixel is its own window.
+static inline void IRAM_ATTR gpioWrite(int pin, bool level) {
+  if (pin < 32) {
+    if (level) GPIO.out_w1ts = 1u << pin;
+    else GPIO.out_w1tc = 1u << pin;
+  } else {
+    if (level) GPIO.out1_w1ts.val = 1u << (pin - 32);
+    else GPIO.out1_w1tc.val = 1u << (pin - 32);
+  }
+}
+
+// The transaction's user field carries the DC pin and its level, so the callback
+// needs no driver instance.
+static void IRAM_ATTR dcPreTransfer(spi_transaction_t *t) {
+  uint32_t v = (uint32_t)(uintptr_t)t->user;
+  gpioWrite((int)(v & 0xFFu), (v >> 8) != 0);
+}
+
+static void *dcUser(int pin, bool level) {
+  return (void *)(uintptr_t)((uint32_t)pin | (level ? 0x100u : 0u));
+}
+
+static inline uint16_t wireOrder(uint16_t color565) {
+  return (uint16_t)((color565 >> 8) | (color565 << 8));
+}
 
 DisplaySt7789::DisplaySt7789(DisplayPins pins) : pins_(pins) {}
 
@@ -20,25 +51,203 @@ void DisplaySt7789::begin() {
 
   SPI.begin(pins_.sclk, -1, pins_.mosi, pins_.cs);
 
+  // The panel is always brought up over Arduino SPI; a DMA request switches after.
+  DisplayBusMode want = mode_;
+  mode_ = DisplayBusMode::Blocking;
+  windowValid_ = false;
   beginWrite();
   resetActiveHigh();
   initN_C0();
   endWrite();
+  started_ = true;
+  if (want == DisplayBusMode::Dma) setBusMode(DisplayBusMode::Dma);
 }
 
 void DisplaySt7789::beginWrite() {
   if (writing_) return;
-  SPI.beginTransaction(SPISettings(SpiHz, MSBFIRST, SPI_MODE0));
+  if (mode_ == DisplayBusMode::Blocking) SPI.beginTransaction(SPISettings(clockHz_, MSBFIRST, SPI_MODE0));
   writing_ = true;
 }
 
 void DisplaySt7789::endWrite() {
   if (!writing_) return;
-  SPI.endTransaction();
+  if (fbOn_ && dirtyAny_) presentTiles();
+  if (mode_ == DisplayBusMode::Blocking) SPI.endTransaction();
   writing_ = false;
 }
 
+void DisplaySt7789::flush() {
+  if (fbOn_ && dirtyAny_) {
+    if (writing_) {
+      presentTiles();
+    } else {
+      beginWrite();
+      endWrite();
+    }
+  }
+  dmaDrain();
+}
+
+void DisplaySt7789::dmaDrain() {
+  while (dmaInFlight_ > 0) dmaRetire();
+}
+
+// Switching hands SPI2 between the Arduino driver and spi_master. The panel keeps its
+// state, so nothing is re-initialized.
+bool DisplaySt7789::setBusMode(DisplayBusMode mode) {
+  if (mode == mode_) return true;
+  if (!started_) {
+    mode_ = mode;
+    return true;
+  }
+  bool writing = writing_;
+  endWrite();
+  if (mode == DisplayBusMode::Dma) {
+    SPI.end();
+    if (!dmaAttach()) {
+      SPI.begin(pins_.sclk, -1, pins_.mosi, pins_.cs);
+      if (writing) beginWrite();
+      return false;
+    }
+  } else {
+    dmaDetach();
+    pinMode(pins_.cs, OUTPUT);
+    digitalWrite(pins_.cs, HIGH);
+    pinMode(pins_.dc, OUTPUT);
+    SPI.begin(pins_.sclk, -1, pins_.mosi, pins_.cs);
+  }
+  mode_ = mode;
+  if (writing) beginWrite();
+  return true;
+}
+
+bool DisplaySt7789::setClockHz(uint32_t hz) {
+  if (hz == 0) return false;
+  if (hz == clockHz_) return true;
+  uint32_t prev = clockHz_;
+  clockHz_ = hz;
+  if (mode_ == DisplayBusMode::Dma && spiDev_) {
+    dmaDetach();
+    if (!dmaAttach()) {
+      clockHz_ = prev;
+      dmaAttach();
+      return false;
+    }
+  } else if (writing_) {
+    SPI.endTransaction();
+    SPI.beginTransaction(SPISettings(clockHz_, MSBFIRST, SPI_MODE0));
+  }
+  return true;
+}
+
+bool DisplaySt7789::dmaAttach() {
+  if (spiDev_) return true;
+  for (int i = 0; i < 2; ++i) {
+    if (!dmaBuf_[i]) dmaBuf_[i] = (uint8_t *)heap_caps_malloc(DmaChunkPixels * 2, MALLOC_CAP_DMA);
+    if (!dmaBuf_[i]) return false;
+    dmaFilled_[i] = 0;
+  }
+
+  spi_bus_config_t bus = {};
+  bus.mosi_io_num = pins_.mosi;
+  bus.miso_io_num = -1;
+  bus.sclk_io_num = pins_.sclk;
+  bus.quadwp_io_num = -1;
+  bus.quadhd_io_num = -1;
+  bus.max_transfer_sz = DmaChunkPixels * 2;
+  if (spi_bus_initialize(DisplaySpiHost, &bus, SPI_DMA_CH_AUTO) != ESP_OK) return false;
+
+  spi_device_interface_config_t dev = {};
+  dev.mode = 0;
+  dev.clock_speed_hz = (int)clockHz_;
+  dev.spics_io_num = pins_.cs;
+  dev.flags = SPI_DEVICE_NO_DUMMY;
+  dev.queue_size = 2;
+  dev.pre_cb = dcPreTransfer;
+  if (spi_bus_add_device(DisplaySpiHost, &dev, &spiDev_) != ESP_OK) {
+    spiDev_ = nullptr;
+    spi_bus_free(DisplaySpiHost);
+    return false;
+  }
+  dmaNext_ = 0;
+  dmaInFlight_ = 0;
+  return true;
+}
+
+void DisplaySt7789::dmaDetach() {
+  if (!spiDev_) return;
+  dmaDrain();
+  spi_bus_remove_device(spiDev_);
+  spi_bus_free(DisplaySpiHost);
+  spiDev_ = nullptr;
+  gpio_reset_pin((gpio_num_t)pins_.mosi);
+  gpio_reset_pin((gpio_num_t)pins_.sclk);
+  gpio_reset_pin((gpio_num_t)pins_.cs);
+}
+
+// Short command and parameter writes go out by polling, which needs an idle queue.
+// keepCs holds CS low into the next transaction; the caller must own the bus.
+void DisplaySt7789::dmaPolling(bool dc, const uint8_t *buf, size_t len, bool keepCs) {
+  dmaDrain();
+  spi_transaction_t t = {};
+  t.length = len * 8;
+  if (keepCs) t.flags = SPI_TRANS_CS_KEEP_ACTIVE;
+  t.user = dcUser(pins_.dc, dc);
+  if (len <= 4) {
+    t.flags |= SPI_TRANS_USE_TXDATA;
+    memcpy(t.tx_data, buf, len);
+  } else {
+    t.tx_buffer = buf;
+  }
+  spi_device_polling_transmit(spiDev_, &t);
+}
+
+void DisplaySt7789::dmaQueue(int buffer, size_t len) {
+  spi_transaction_t &t = dmaTrans_[buffer];
+  t = spi_transaction_t{};
+  t.length = len * 8;
+  t.tx_buffer = dmaBuf_[buffer];
+  t.user = dcUser(pins_.dc, true);
+  if (spi_device_queue_trans(spiDev_, &t, portMAX_DELAY) == ESP_OK) dmaInFlight_++;
+}
+
+// Completions come back in queue order, so this frees the older buffer.
+void DisplaySt7789::dmaRetire() {
+  spi_transaction_t *done = nullptr;
+  int64_t t0 = esp_timer_get_time();
+  spi_device_get_trans_result(spiDev_, &done, portMAX_DELAY);
+  waitUs_ += (uint64_t)(esp_timer_get_time() - t0);
+  dmaInFlight_--;
+}
+
+// Ping-pong: one buffer is refilled while the other is on the wire. A buffer still
+// holding the same colour is queued again as is.
+void DisplaySt7789::dmaColor(uint16_t color565, size_t pixelCount) {
+  uint16_t swapped = wireOrder(color565);
+  while (pixelCount) {
+    size_t batch = pixelCount > DmaChunkPixels ? DmaChunkPixels : pixelCount;
+    int b = dmaNext_;
+    dmaNext_ ^= 1;
+    if (dmaInFlight_ == 2) dmaRetire();
+    if (dmaColor_[b] != color565) {
+      dmaColor_[b] = color565;
+      dmaFilled_[b] = 0;
+    }
+    if (dmaFilled_[b] < batch) {
+      uint16_t *px = (uint16_t *)dmaBuf_[b];
+      for (size_t i = dmaFilled_[b]; i < batch; ++i) px[i] = swapped;
+      dmaFilled_[b] = batch;
+    }
+    dmaQueue(b, batch * 2);
+    pixelCount -= batch;
+  }
+}
+
 void DisplaySt7789::cmd(uint8_t c) {
+  if (mode_ == DisplayBusMode::Dma) {
+    dmaPolling(false, &c, 1);
+    return;
+  }
   digitalWrite(pins_.dc, LOW);
   digitalWrite(pins_.cs, LOW);
   SPI.write(c);
@@ -46,6 +255,10 @@ void DisplaySt7789::cmd(uint8_t c) {
 }
 
 void DisplaySt7789::data8(uint8_t d) {
+  if (mode_ == DisplayBusMode::Dma) {
+    dmaPolling(true, &d, 1);
+    return;
+  }
   digitalWrite(pins_.dc, HIGH);
   digitalWrite(pins_.cs, LOW);
   SPI.write(d);
@@ -53,10 +266,19 @@ void DisplaySt7789::data8(uint8_t d) {
 }
 
 void DisplaySt7789::dataBuf(const uint8_t *buf, size_t len) {
-  digitalWrite(pins_.dc, HIGH);
-  digitalWrite(pins_.cs, LOW);
+  if (mode_ == DisplayBusMode::Dma) {
+    dmaPolling(true, buf, len);
+    return;
+  }
+  gpioWrite(pins_.dc, true);
+  gpioWrite(pins_.cs, false);
   SPI.writeBytes(buf, len);
-  digitalWrite(pins_.cs, HIGH);
+  gpioWrite(pins_.cs, true);
+}
+
+void DisplaySt7789::setBatchedAddr(bool on) {
+  batchedAddr_ = on;
+  windowValid_ = false;
 }
 
 void DisplaySt7789::setAddr(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1) {
@@ -65,6 +287,10 @@ void DisplaySt7789::setAddr(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1)
   y0 = (uint16_t)(y0 + Yoff);
   y1 = (uint16_t)(y1 + Yoff);
 
+  if (batchedAddr_) {
+    setAddrBatched(x0, y0, x1, y1);
+    return;
+  }
   cmd(0x2A);
   data8(x0 >> 8); data8(x0 & 0xFF);
   data8(x1 >> 8); data8(x1 & 0xFF);
@@ -74,10 +300,67 @@ void DisplaySt7789::setAddr(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1)
   cmd(0x2C);
 }
 
+// CASET, RASET and RAMWR under one CS assertion. The panel keeps the last window, so
+// an axis whose range is unchanged is not resent; RAMWR alone restarts at its corner.
+void DisplaySt7789::setAddrBatched(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1) {
+  bool sendX = !windowValid_ || x0 != window_[0] || x1 != window_[2];
+  bool sendY = !windowValid_ || y0 != window_[1] || y1 != window_[3];
+  window_[0] = x0;
+  window_[1] = y0;
+  window_[2] = x1;
+  window_[3] = y1;
+  windowValid_ = true;
+  const uint8_t params[8] = {
+      (uint8_t)(x0 >> 8), (uint8_t)x0, (uint8_t)(x1 >> 8), (uint8_t)x1,
+      (uint8_t)(y0 >> 8), (uint8_t)y0, (uint8_t)(y1 >> 8), (uint8_t)y1,
+  };
+  static const uint8_t Caset = 0x2A;
+  static const uint8_t Raset = 0x2B;
+  static const uint8_t Ramwr = 0x2C;
+
+  if (mode_ == DisplayBusMode::Dma) {
+    dmaDrain();
+    spi_device_acquire_bus(spiDev_, portMAX_DELAY);
+    if (sendX) {
+      dmaPolling(false, &Caset, 1, true);
+      dmaPolling(true, params, 4, true);
+    }
+    if (sendY) {
+      dmaPolling(false, &Raset, 1, true);
+      dmaPolling(true, params + 4, 4, true);
+    }
+    dmaPolling(false, &Ramwr, 1);
+    spi_device_release_bus(spiDev_);
+    return;
+  }
+
+  gpioWrite(pins_.cs, false);
+  if (sendX) {
+    gpioWrite(pins_.dc, false);
+    SPI.write(Caset);
+    gpioWrite(pins_.dc, true);
+    SPI.writeBytes(params, 4);
+  }
+  if (sendY) {
+    gpioWrite(pins_.dc, false);
+    SPI.write(Raset);
+    gpioWrite(pins_.dc, true);
+    SPI.writeBytes(params + 4, 4);
+  }
+  gpioWrite(pins_.dc, false);
+  SPI.write(Ramwr);
+  gpioWrite(pins_.cs, true);
+}
+
 void DisplaySt7789::writeColor(uint16_t color565, size_t pixelCount) {
+  if (mode_ == DisplayBusMode::Dma && pixelCount > 2) {
+    dmaColor(color565, pixelCount);
+    return;
+  }
   const size_t chunkPixels = 256;
   uint8_t buf[chunkPixels * 2];
-  for (size_t i = 0; i < chunkPixels; ++i) {
+  size_t fill = pixelCount < chunkPixels ? pixelCount : chunkPixels;
+  for (size_t i = 0; i < fill; ++i) {
     buf[i * 2 + 0] = (uint8_t)(color565 >> 8);
     buf[i * 2 + 1] = (uint8_t)(color565 & 0xFF);
   }
@@ -90,10 +373,259 @@ void DisplaySt7789::writeColor(uint16_t color565, size_t pixelCount) {
 
 void DisplaySt7789::fillRect(int x, int y, int w, int h, uint16_t color565) {
   if (w <= 0 || h <= 0) return;
+  if (fbOn_) {
+    fbFill(x, y, w, h, color565);
+    return;
+  }
   setAddr((uint16_t)x, (uint16_t)y, (uint16_t)(x + w - 1), (uint16_t)(y + h - 1));
   writeColor(color565, (size_t)w * (size_t)h);
 }
 
+uint16_t *DisplaySt7789::pixelBuffer(size_t &room) {
+  if (mode_ == DisplayBusMode::Dma) {
+    int b = dmaNext_;
+    if (dmaInFlight_ == 2) dmaRetire();
+    dmaFilled_[b] = 0;
+    room = DmaChunkPixels;
+    return (uint16_t *)dmaBuf_[b];
+  }
+  room = Width;
+  return line_;
+}
+
+void DisplaySt7789::commitPixels(size_t n) {
+  if (n == 0) return;
+  if (mode_ == DisplayBusMode::Dma) {
+    dmaQueue(dmaNext_, n * 2);
+    dmaNext_ ^= 1;
+    return;
+  }
+  dataBuf((const uint8_t *)line_, n * 2);
+}
+
+// pixelAt(col, row) returns the wire-order colour of a bitmap pixel; only the visible
+// part is expanded, as many whole rows per buffer as fit.
+template <typename PixelAt>
+void DisplaySt7789::blitRows(int x, int y, int w, int h, PixelAt pixelAt) {
+  int c0 = x < 0 ? -x : 0;
+  int c1 = x + w > Width ? Width - x : w;
+  int r0 = y < 0 ? -y : 0;
+  int r1 = y + h > Height ? Height - y : h;
+  if (c0 >= c1 || r0 >= r1) return;
+  size_t cols = (size_t)(c1 - c0);
+  if (fbOn_) {
+    for (int r = r0; r < r1; ++r) {
+      uint16_t *row = fb_ + (size_t)(y + r) * Width + (size_t)x;
+      for (int c = c0; c < c1; ++c) row[c] = pixelAt(c, r);
+    }
+    fbTouched(x + c0, y + r0, x + c1 - 1, y + r1 - 1);
+    return;
+  }
+  setAddr((uint16_t)(x + c0), (uint16_t)(y + r0), (uint16_t)(x + c1 - 1), (uint16_t)(y + r1 - 1));
+  int r = r0;
+  while (r < r1) {
+    size_t room = 0;
+    uint16_t *out = pixelBuffer(room);
+    size_t rows = room / cols;
+    if (rows > (size_t)(r1 - r)) rows = (size_t)(r1 - r);
+    uint16_t *p = out;
+    for (size_t i = 0; i < rows; ++i, ++r) {
+      for (int c = c0; c < c1; ++c) *p++ = pixelAt(c, r);
+    }
+    commitPixels(rows * cols);
+  }
+}
+
+void DisplaySt7789::blit1bpp(int x, int y, int w, int h, const uint8_t *bits, size_t strideBytes, uint16_t fg, uint16_t bg, int scale, bool lsbFirst) {
+  if (!bits || w <= 0 || h <= 0) return;
+  if (scale < 1) scale = 1;
+  uint16_t on = wireOrder(fg);
+  uint16_t off = wireOrder(bg);
+  blitRows(x, y, w * scale, h * scale, [&](int c, int r) {
+    int sc = c / scale;
+    uint8_t b = bits[(size_t)(r / scale) * strideBytes + (size_t)(sc >> 3)];
+    uint8_t mask = lsbFirst ? (uint8_t)(0x01u << (sc & 7)) : (uint8_t)(0x80u >> (sc & 7));
+    return (b & mask) ? on : off;
+  });
+}
+
+void DisplaySt7789::blit4bpp(int x, int y, int w, int h, const uint8_t *data, const uint16_t palette[16]) {
+  if (!data || !palette || w <= 0 || h <= 0) return;
+  uint16_t wire[16];
+  for (int i = 0; i < 16; ++i) wire[i] = wireOrder(palette[i]);
+  blitRows(x, y, w, h, [&](int c, int r) {
+    size_t idx = (size_t)r * (size_t)w + (size_t)c;
+    uint8_t b = data[idx / 2];
+    return wire[(idx & 1) ? (b & 0x0Fu) : (b >> 4)];
+  });
+}
+
+void DisplaySt7789::blitRgb565(int x, int y, int w, int h, const uint16_t *pixels) {
+  if (!pixels || w <= 0 || h <= 0) return;
+  blitRows(x, y, w, h, [&](int c, int r) {
+    return wireOrder(pixels[(size_t)r * (size_t)w + (size_t)c]);
+  });
+}
+
+// A band is as many region rows as the next transfer buffer holds: one row through the
+// Arduino line buffer, several per DMA buffer.
+void DisplaySt7789::drawList(const DisplayList &list) {
+  int x = list.x();
+  int w = list.width();
+  int y0 = list.y() < 0 ? 0 : list.y();
+  int y1 = list.y() + list.height() > Height ? Height : list.y() + list.height();
+  if (w <= 0 || x < 0 || x + w > Width || y0 >= y1) return;
+  if (fbOn_) {
+    list.rasterize(y0, y1 - y0, fb_ + (size_t)y0 * Width + (size_t)x, Width, true);
+    fbTouched(x, y0, x + w - 1, y1 - 1);
+    return;
+  }
+  setAddr((uint16_t)x, (uint16_t)y0, (uint16_t)(x + w - 1), (uint16_t)(y1 - 1));
+  int y = y0;
+  while (y < y1) {
+    size_t room = 0;
+    uint16_t *out = pixelBuffer(room);
+    int rows = (int)(room / (size_t)w);
+    if (rows > y1 - y) rows = y1 - y;
+    list.rasterize(y, rows, out, (size_t)w, true);
+    commitPixels((size_t)rows * (size_t)w);
+    y += rows;
+  }
+}
+
+void DisplaySt7789::blitRle(const RleImage &image) {
+  int x = image.x;
+  int y = image.y;
+  int w = image.w;
+  int h = image.h;
+  if (w <= 0 || h <= 0 || x < 0 || y < 0 || x + w > Width || y + h > Height) return;
+  RleDecoder dec;
+  dec.begin(image);
+  if (fbOn_) {
+    for (int r = 0; r < h; ++r) dec.read(fb_ + (size_t)(y + r) * Width + (size_t)x, (size_t)w, true);
+    fbTouched(x, y, x + w - 1, y + h - 1);
+    return;
+  }
+  setAddr((uint16_t)x, (uint16_t)y, (uint16_t)(x + w - 1), (uint16_t)(y + h - 1));
+  while (dec.remaining() > 0) {
+    size_t room = 0;
+    uint16_t *out = pixelBuffer(room);
+    size_t n = dec.read(out, room, true);
+    if (n == 0) break;
+    commitPixels(n);
+  }
+}
+
+// Both copies live in PSRAM: fb_ is drawn into, shown_ mirrors the panel. Tiles only
+// go out when they differ from the mirror, so redrawing identical content costs no
+// SPI traffic even if it was erased in between.
+bool DisplaySt7789::setFramebuffer(bool on) {
+  if (!on) {
+    if (fbOn_) flush();
+    fbOn_ = false;
+    return true;
+  }
+  if (fbOn_) return true;
+  size_t bytes = (size_t)Width * Height * 2;
+  if (!fb_) fb_ = (uint16_t *)heap_caps_malloc(bytes, MALLOC_CAP_SPIRAM);
+  if (!shown_) shown_ = (uint16_t *)heap_caps_malloc(bytes, MALLOC_CAP_SPIRAM);
+  if (!fb_ || !shown_) return false;
+  // The panel content is unknown, so the first flush sends every tile.
+  memset(fb_, 0, bytes);
+  for (int ty = 0; ty < TilesY; ++ty) dirty_[ty] = (1u << TilesX) - 1u;
+  dirtyAny_ = true;
+  forceAll_ = true;
+  fbOn_ = true;
+  return true;
+}
+
+void DisplaySt7789::resetFlushStats() {
+  stats_ = DisplayFlushStats{};
+}
+
+void DisplaySt7789::fbTouched(int x0, int y0, int x1, int y1) {
+  stats_.drawnBytes += (uint64_t)(x1 - x0 + 1) * (uint64_t)(y1 - y0 + 1) * 2u;
+  uint32_t mask = ((2u << (x1 / TileSize)) - 1u) & ~((1u << (x0 / TileSize)) - 1u);
+  for (int ty = y0 / TileSize; ty <= y1 / TileSize; ++ty) dirty_[ty] |= mask;
+  dirtyAny_ = true;
+  if (!writing_) {
+    beginWrite();
+    endWrite();
+  }
+}
+
+void DisplaySt7789::fbFill(int x, int y, int w, int h, uint16_t color565) {
+  int x0 = x < 0 ? 0 : x;
+  int y0 = y < 0 ? 0 : y;
+  int x1 = x + w > Width ? Width - 1 : x + w - 1;
+  int y1 = y + h > Height ? Height - 1 : y + h - 1;
+  if (x0 > x1 || y0 > y1) return;
+  uint16_t wire = wireOrder(color565);
+  for (int r = y0; r <= y1; ++r) {
+    uint16_t *row = fb_ + (size_t)r * Width;
+    for (int c = x0; c <= x1; ++c) row[c] = wire;
+  }
+  fbTouched(x0, y0, x1, y1);
+}
+
+bool DisplaySt7789::tileChanged(int tx, int ty) const {
+  int x = tx * TileSize;
+  int y1 = (ty + 1) * TileSize;
+  if (y1 > Height) y1 = Height;
+  for (int y = ty * TileSize; y < y1; ++y) {
+    size_t at = (size_t)y * Width + (size_t)x;
+    if (memcmp(fb_ + at, shown_ + at, TileSize * 2) != 0) return true;
+  }
+  return false;
+}
+
+// Runs of changed tiles along a tile row go out as one window each.
+void DisplaySt7789::presentTiles() {
+  uint32_t frameBytes = 0;
+  uint16_t frameTiles = 0;
+  for (int ty = 0; ty < TilesY; ++ty) {
+    uint32_t dirty = dirty_[ty];
+    dirty_[ty] = 0;
+    int tx = 0;
+    while (tx < TilesX) {
+      if (!(dirty & (1u << tx)) || (!forceAll_ && !tileChanged(tx, ty))) {
+        ++tx;
+        continue;
+      }
+      int end = tx + 1;
+      while (end < TilesX && (dirty & (1u << end)) && (forceAll_ || tileChanged(end, ty))) ++end;
+      int x0 = tx * TileSize;
+      int cols = (end - tx) * TileSize;
+      int y0 = ty * TileSize;
+      int y1 = y0 + TileSize > Height ? Height : y0 + TileSize;
+      setAddr((uint16_t)x0, (uint16_t)y0, (uint16_t)(x0 + cols - 1), (uint16_t)(y1 - 1));
+      int y = y0;
+      while (y < y1) {
+        size_t room = 0;
+        uint16_t *out = pixelBuffer(room);
+        int rows = (int)(room / (size_t)cols);
+        if (rows > y1 - y) rows = y1 - y;
+        for (int i = 0; i < rows; ++i, ++y) {
+          size_t at = (size_t)y * Width + (size_t)x0;
+          memcpy(out + (size_t)i * cols, fb_ + at, (size_t)cols * 2);
+          memcpy(shown_ + at, fb_ + at, (size_t)cols * 2);
+        }
+        commitPixels((size_t)rows * cols);
+      }
+      frameBytes += (uint32_t)(cols * (y1 - y0) * 2);
+      frameTiles = (uint16_t)(frameTiles + (end - tx));
+      tx = end;
+    }
+  }
+  dirtyAny_ = false;
+  forceAll_ = false;
+  stats_.frames++;
+  stats_.flushedBytes += frameBytes;
+  stats_.lastFrameBytes = frameBytes;
+  stats_.lastFrameTiles = frameTiles;
+  if (frameBytes > stats_.maxFrameBytes) stats_.maxFrameBytes = frameBytes;
+}
+
 void DisplaySt7789::clear(uint16_t color565) {
   fillRect(0, 0, Width, Height, color565);
 }
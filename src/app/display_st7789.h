@@ -2,6 +2,10 @@
 
 #include <Arduino.h>
 #include <SPI.h>
+#include <driver/spi_master.h>
+
+#include "app/display_list.h"
+#include "app/rle_image.h"
 
 namespace aiw {
 
@@ -15,6 +19,23 @@ struct DisplayPins {
   int blBox3;
 };
 
+enum class DisplayBusMode : uint8_t {
+  // Arduino SPI; every chunk is written before the call returns.
+  Blocking = 0,
+  // IDF spi_master on SPI2; pixel chunks are queued from two DMA buffers.
+  Dma = 1,
+};
+
+struct DisplayFlushStats {
+  uint32_t frames = 0;
+  // Pixel bytes the drawing calls produced, i.e. what drawing straight to the panel sends.
+  uint64_t drawnBytes = 0;
+  uint64_t flushedBytes = 0;
+  uint32_t lastFrameBytes = 0;
+  uint32_t maxFrameBytes = 0;
+  uint16_t lastFrameTiles = 0;
+};
+
 class DisplaySt7789 {
 public:
   static constexpr int Width = 320;
@@ -27,21 +48,106 @@ public:
   void fillRect(int x, int y, int w, int h, uint16_t color565);
   void drawBorder(uint16_t color565, int thickness);
 
+  // Bitmaps are expanded row by row into a line buffer and streamed through one
+  // address window, clipped to the screen. 1bpp rows are strideBytes long, MSB first
+  // unless lsbFirst, set bits fg; scale repeats every bit as a scale x scale block.
+  void blit1bpp(int x, int y, int w, int h, const uint8_t *bits, size_t strideBytes, uint16_t fg, uint16_t bg, int scale = 1, bool lsbFirst = false);
+  // 4bpp pixels run on across rows, two per byte, high nibble first; each value picks
+  // a palette colour.
+  void blit4bpp(int x, int y, int w, int h, const uint8_t *data, const uint16_t palette[16]);
+  void blitRgb565(int x, int y, int w, int h, const uint16_t *pixels);
+  // Renders the list region in bands, straight into the transfer or framebuffer. The
+  // region is skipped unless it fits horizontally on screen; rows are clipped.
+  void drawList(const DisplayList &list);
+  // Decodes the image straight into the transfer or framebuffer at its own position;
+  // skipped unless it lies fully on screen.
+  void blitRle(const RleImage &image);
+
+  // With the framebuffer on, the outermost endWrite() sends the changed tiles.
   void beginWrite();
   void endWrite();
+  // In DMA mode drawing calls return while the last chunks are still on the wire;
+  // flush() sends pending tiles and waits for them.
+  void flush();
+
+  // Shadow RGB565 framebuffer in PSRAM; false when PSRAM is missing. Turning it on
+  // resends the whole screen on the next flush, so the caller should redraw first.
+  bool setFramebuffer(bool on);
+  bool framebuffer() const { return fbOn_; }
+  const DisplayFlushStats &flushStats() const { return stats_; }
+  void resetFlushStats();
+
+  bool setBusMode(DisplayBusMode mode);
+  DisplayBusMode busMode() const { return mode_; }
+  bool setClockHz(uint32_t hz);
+  uint32_t clockHz() const { return clockHz_; }
+  // Time spent blocked on DMA completions, i.e. CPU time left to other tasks.
+  uint64_t busWaitUs() const { return waitUs_; }
+  // Off sends the window one byte per CS cycle, as the driver originally did.
+  void setBatchedAddr(bool on);
+  bool batchedAddr() const { return batchedAddr_; }
 
 private:
+  static constexpr size_t DmaChunkPixels = 2048;
+  static constexpr int TileSize = 16;
+  static constexpr int TilesX = Width / TileSize;
+  static constexpr int TilesY = (Height + TileSize - 1) / TileSize;
+
   void cmd(uint8_t c);
   void data8(uint8_t d);
   void dataBuf(const uint8_t *buf, size_t len);
   void setAddr(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1);
+  void setAddrBatched(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1);
   void writeColor(uint16_t color565, size_t pixelCount);
+  // Room for the next run of window pixels, in wire byte order; commitPixels sends n.
+  uint16_t *pixelBuffer(size_t &room);
+  void commitPixels(size_t n);
+  template <typename PixelAt>
+  void blitRows(int x, int y, int w, int h, PixelAt pixelAt);
   void resetActiveHigh();
   void initN_C0();
 
+  bool dmaAttach();
+  void dmaDetach();
+  void dmaPolling(bool dc, const uint8_t *buf, size_t len, bool keepCs = false);
+  void dmaQueue(int buffer, size_t len);
+  void dmaRetire();
+  void dmaDrain();
+  void dmaColor(uint16_t color565, size_t pixelCount);
+
+  void fbFill(int x, int y, int w, int h, uint16_t color565);
+  void fbTouched(int x0, int y0, int x1, int y1);
+  bool tileChanged(int tx, int ty) const;
+  void presentTiles();
+
   DisplayPins pins_;
   bool writing_{false};
+  bool started_{false};
+  DisplayBusMode mode_{DisplayBusMode::Blocking};
+  bool batchedAddr_{true};
+  // Last window sent to the panel: x0, y0, x1, y1.
+  bool windowValid_{false};
+  uint16_t window_[4]{0, 0, 0, 0};
+  uint32_t clockHz_{10000000};
+  spi_device_handle_t spiDev_{nullptr};
+  uint8_t *dmaBuf_[2]{nullptr, nullptr};
+  spi_transaction_t dmaTrans_[2]{};
+  // Pixels of dmaColor_ already in each buffer, so a long fill only writes them once.
+  size_t dmaFilled_[2]{0, 0};
+  uint16_t dmaColor_[2]{0, 0};
+  int dmaNext_{0};
+  int dmaInFlight_{0};
+  uint64_t waitUs_{0};
+  uint16_t line_[Width];
+
+  bool fbOn_{false};
+  uint16_t *fb_{nullptr};
+  uint16_t *shown_{nullptr};
+  // One bit per tile column, per tile row.
+  uint32_t dirty_[TilesY]{};
+  bool dirtyAny_{false};
+  bool forceAll_{false};
+  DisplayFlushStats stats_;
 };
 
 }  // namespace aiw
-
@@ -0,0 +1,146 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+namespace aiw {
+
+enum class HampelVerdict : uint8_t { Accept = 0, Held = 1, Step = 2 };
+
+// Causal Hampel prefilter over the last length() accepted samples. A sample further
+// than max(minCounts, sigmas * 1.4826 * MAD) from the running median is held back
+// and replaced by the median. The next sample decides: if it lands on the same side
+// of the old median the jump was a real step and the history restarts at the new
+// level; otherwise the held sample is counted as a rejected spike.
+class HampelFilter {
+public:
+  static constexpr int MaxLength = 15;
+
+  explicit HampelFilter(int length = 5, int32_t minCounts = 2000, uint8_t sigmas = 3) { configure(length, minCounts, sigmas); }
+
+  void configure(int length, int32_t minCounts, uint8_t sigmas) {
+    if (length < 3) length = 3;
+    if (length > MaxLength) length = MaxLength;
+    if (minCounts < 1) minCounts = 1;
+    length_ = (uint8_t)length;
+    minCounts_ = minCounts;
+    sigmas_ = sigmas;
+    reset();
+  }
+  int length() const { return length_; }
+  int32_t minCounts() const { return minCounts_; }
+
+  void reset() {
+    count_ = 0;
+    head_ = 0;
+    pending_ = false;
+  }
+
+  HampelVerdict push(int32_t x, int32_t &out) {
+    if (count_ < 3) {
+      if (pending_) {
+        // Too little history to judge the held sample; let both through.
+        pending_ = false;
+        remember(pendingValue_);
+      }
+      remember(x);
+      out = x;
+      return HampelVerdict::Accept;
+    }
+
+    int32_t median = 0;
+    int32_t threshold = 0;
+    bounds(median, threshold);
+    int32_t dev = x - median;
+    bool outlier = dev > threshold || dev < -threshold;
+
+    if (!outlier) {
+      if (pending_) spikes_++;
+      pending_ = false;
+      remember(x);
+      out = x;
+      return HampelVerdict::Accept;
+    }
+
+    bool above = dev > 0;
+    if (pending_ && above == pendingAbove_) {
+      steps_++;
+      pending_ = false;
+      count_ = 0;
+      head_ = 0;
+      remember(pendingValue_);
+      remember(x);
+      out = x;
+      return HampelVerdict::Step;
+    }
+
+    if (pending_) spikes_++;
+    pending_ = true;
+    pendingAbove_ = above;
+    pendingValue_ = x;
+    held_++;
+    out = median;
+    return HampelVerdict::Held;
+  }
+
+  bool pending() const { return pending_; }
+  uint32_t spikes() const { return spikes_; }
+  uint32_t steps() const { return steps_; }
+  uint32_t held() const { return held_; }
+  void clearCounters() {
+    spikes_ = 0;
+    steps_ = 0;
+    held_ = 0;
+  }
+
+private:
+  void remember(int32_t v) {
+    history_[head_] = v;
+    head_ = (uint8_t)((head_ + 1) % length_);
+    if (count_ < length_) count_++;
+  }
+
+  static int32_t medianOf(int32_t *v, int n) {
+    for (int i = 1; i < n; ++i) {
+      int32_t key = v[i];
+      int j = i - 1;
+      while (j >= 0 && v[j] > key) {
+        v[j + 1] = v[j];
+        --j;
+      }
+      v[j + 1] = key;
+    }
+    if (n & 1) return v[n / 2];
+    return (int32_t)(((int64_t)v[n / 2 - 1] + v[n / 2]) / 2);
+  }
+
+  void bounds(int32_t &median, int32_t &threshold) const {
+    int32_t tmp[MaxLength];
+    int n = count_;
+    for (int i = 0; i < n; ++i) tmp[i] = history_[i];
+    median = medianOf(tmp, n);
+    for (int i = 0; i < n; ++i) {
+      int32_t d = history_[i] - median;
+      tmp[i] = d < 0 ? -d : d;
+    }
+    int32_t mad = medianOf(tmp, n);
+    // 1.4826 * MAD estimates sigma for Gaussian noise; 380/256 ~= 1.484.
+    int64_t t = ((int64_t)mad * sigmas_ * 380) >> 8;
+    threshold = t > minCounts_ ? (int32_t)t : minCounts_;
+  }
+
+  uint8_t length_ = 5;
+  uint8_t sigmas_ = 3;
+  int32_t minCounts_ = 2000;
+  int32_t history_[MaxLength] = {0};
+  uint8_t count_ = 0;
+  uint8_t head_ = 0;
+  bool pending_ = false;
+  bool pendingAbove_ = false;
+  int32_t pendingValue_ = 0;
+  uint32_t spikes_ = 0;
+  uint32_t steps_ = 0;
+  uint32_t held_ = 0;
+};
+
+}  // namespace aiw
@@ -2,25 +2,55 @@
 
 namespace aiw {
 
+static constexpr spi_host_device_t Hx711SpiHost = SPI3_HOST;
+static constexpr int Hx711SpiHz = 1000000;
+static constexpr size_t Hx711SpiBytes = 7;
+
 Hx711::Hx711(Hx711Pins pins) : pins_(pins) {}
 
 void Hx711::begin() {
   pinMode(pins_.dout, INPUT_PULLUP);
   pinMode(pins_.sck, OUTPUT);
   digitalWrite(pins_.sck, LOW);
+  if (pins_.rate >= 0) {
+    pinMode(pins_.rate, OUTPUT);
+    digitalWrite(pins_.rate, rate_ == Hx711Rate::Sps80 ? HIGH : LOW);
+  }
 }
 
 bool Hx711::isReady() const {
   return digitalRead(pins_.dout) == LOW;
 }
 
+int32_t Hx711::readRaw() {
+  return readRaw(conversionTimeoutMs());
+}
+
 int32_t Hx711::readRaw(uint32_t timeoutMs) {
   uint32_t start = millis();
-  while (!isReady()) {
-    if (millis() - start > timeoutMs) return INT32_MIN;
-    delay(1);
+  for (;;) {
+    while (!isReady()) {
+      if (millis() - start > timeoutMs) return INT32_MIN;
+      delay(1);
+    }
+    bool discard = settling();
+    int32_t v = readConversion();
+    if (!discard) return v;
+    start = millis();
   }
+}
 
+// Returns INT32_MIN for conversions still settling after a gain or rate change.
+int32_t Hx711::readConversion() {
+  int32_t v = mode_ == Hx711ReadMode::Spi && spiDev_ ? readSpi() : readBitBang();
+  if (settleRemaining_ > 0) {
+    settleRemaining_ = settleRemaining_ - 1;
+    return INT32_MIN;
+  }
+  return v;
+}
+
+int32_t Hx711::readBitBang() {
   uint32_t value = 0;
   for (int i = 0; i < 24; ++i) {
     digitalWrite(pins_.sck, HIGH);
@@ -30,15 +60,163 @@ int32_t Hx711::readRaw(uint32_t timeoutMs) {
     delayMicroseconds(1);
   }
 
-  digitalWrite(pins_.sck, HIGH);
-  delayMicroseconds(1);
-  digitalWrite(pins_.sck, LOW);
-  delayMicroseconds(1);
+  int extra = (int)gain_ - 24;
+  for (int i = 0; i < extra; ++i) {
+    digitalWrite(pins_.sck, HIGH);
+    delayMicroseconds(1);
+    digitalWrite(pins_.sck, LOW);
+    delayMicroseconds(1);
+  }
+
+  if (value & 0x800000) value |= 0xFF000000;
+  return (int32_t)value;
+}
+
+// MOSI drives SCK: every 0xAA byte is four clock pulses, and MISO is sampled
+// in the middle of each high half-bit, so a read always takes 56 bit times.
+// The last byte carries the 1-3 gain pulses. The controller holds MOSI at the last
+// bit sent, so every byte ends low: SCK idling high for 60 us powers the HX711 down.
+int32_t Hx711::readSpi() {
+  static constexpr uint8_t GainTail[] = {0x80, 0xA0, 0xA8};
+  static_assert((GainTail[0] | GainTail[1] | GainTail[2] | 0xAA) % 2 == 0, "MOSI must idle low");
+  uint8_t tx[Hx711SpiBytes] = {0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, GainTail[(int)gain_ - 25]};
+  uint8_t rx[Hx711SpiBytes] = {0};
+  spi_transaction_t t = {};
+  t.length = Hx711SpiBytes * 8;
+  t.tx_buffer = tx;
+  t.rx_buffer = rx;
+  if (spi_device_polling_transmit(spiDev_, &t) != ESP_OK) return INT32_MIN;
 
+  uint32_t value = 0;
+  for (size_t i = 0; i < 6; ++i) {
+    for (int bit = 7; bit > 0; bit -= 2) {
+      value = (value << 1) | (uint32_t)((rx[i] >> bit) & 0x01u);
+    }
+  }
   if (value & 0x800000) value |= 0xFF000000;
   return (int32_t)value;
 }
 
+bool Hx711::spiAttach() {
+  if (spiDev_) return true;
+  spi_bus_config_t bus = {};
+  bus.mosi_io_num = pins_.sck;
+  bus.miso_io_num = pins_.dout;
+  bus.sclk_io_num = -1;
+  bus.quadwp_io_num = -1;
+  bus.quadhd_io_num = -1;
+  bus.max_transfer_sz = 16;
+  if (spi_bus_initialize(Hx711SpiHost, &bus, SPI_DMA_DISABLED) != ESP_OK) return false;
+
+  spi_device_interface_config_t dev = {};
+  dev.mode = 0;
+  dev.clock_speed_hz = Hx711SpiHz;
+  dev.spics_io_num = -1;
+  dev.queue_size = 1;
+  if (spi_bus_add_device(Hx711SpiHost, &dev, &spiDev_) != ESP_OK) {
+    spiDev_ = nullptr;
+    spi_bus_free(Hx711SpiHost);
+    return false;
+  }
+  gpio_pullup_en((gpio_num_t)pins_.dout);
+  return true;
+}
+
+void Hx711::spiDetach() {
+  if (!spiDev_) return;
+  spi_bus_remove_device(spiDev_);
+  spi_bus_free(Hx711SpiHost);
+  spiDev_ = nullptr;
+  // Only SCK goes back to a plain GPIO; resetting DOUT would clear its edge interrupt.
+  gpio_reset_pin((gpio_num_t)pins_.sck);
+  begin();
+}
+
+bool Hx711::setReadMode(Hx711ReadMode mode) {
+  if (mode == Hx711ReadMode::Spi) {
+    if (!spiAttach()) {
+      mode_ = Hx711ReadMode::BitBang;
+      return false;
+    }
+  } else {
+    spiDetach();
+  }
+  mode_ = mode;
+  return true;
+}
+
+Hx711ReadMode Hx711::readMode() const {
+  return mode_;
+}
+
+// The new gain applies from the conversion after the next read.
+void Hx711::setGain(Hx711Gain gain) {
+  if (gain == gain_) return;
+  gain_ = gain;
+  settleRemaining_ = (uint8_t)(settleSamples() + 1);
+}
+
+Hx711Gain Hx711::gain() const {
+  return gain_;
+}
+
+bool Hx711::setPgaGain(int gain) {
+  setGain(hx711GainForFactor(gain));
+  return hx711GainSupported(gain);
+}
+
+// SCK held high for more than 60 us powers the chip down. On power-up it restarts at
+// A128, so the first conversions are discarded while the configured gain takes over.
+void Hx711::powerDown() {
+  spiDetach();
+  digitalWrite(pins_.sck, HIGH);
+  delayMicroseconds(80);
+}
+
+void Hx711::powerUp() {
+  digitalWrite(pins_.sck, LOW);
+  settleRemaining_ = (uint8_t)(settleSamples() + 1);
+  if (mode_ == Hx711ReadMode::Spi) spiAttach();
+}
+
+// Without a RATE pin the rate only records how the board is strapped.
+bool Hx711::setRate(Hx711Rate rate) {
+  if (rate == rate_) return true;
+  rate_ = rate;
+  if (pins_.rate < 0) return false;
+  digitalWrite(pins_.rate, rate_ == Hx711Rate::Sps80 ? HIGH : LOW);
+  settleRemaining_ = (uint8_t)settleSamples();
+  return true;
+}
+
+Hx711Rate Hx711::rate() const {
+  return rate_;
+}
+
+bool Hx711::hasRatePin() const {
+  return pins_.rate >= 0;
+}
+
+uint32_t Hx711::conversionPeriodUs() const {
+  return hx711ConversionPeriodUs(rate_);
+}
+
+uint32_t Hx711::conversionTimeoutMs() const {
+  return hx711ConversionTimeoutMs(rate_);
+}
+
+int Hx711::averageSamples() const {
+  return hx711AverageSamples(rate_);
+}
+
+int Hx711::settleSamples() const {
+  return hx711SettleSamples(rate_);
+}
+
+bool Hx711::settling() const {
+  return settleRemaining_ > 0;
+}
+
 int32_t Hx711::readAverage(int samples, uint32_t timeoutMs) {
   if (samples < 1) samples = 1;
   int64_t sum = 0;
@@ -67,12 +245,20 @@ float Hx711::scale() const {
   return scale_;
 }
 
+void Hx711::setOffset(int32_t offset) {
+  offset_ = offset;
+}
+
 int32_t Hx711::offset() const {
   return offset_;
 }
 
+int Hx711::doutPin() const {
+  return pins_.dout;
+}
+
 bool Hx711::readWeight(float &weight) {
-  int32_t raw = readAverage(5, 200);
+  int32_t raw = readAverage(averageSamples(), conversionTimeoutMs());
   if (raw == INT32_MIN) return false;
   int32_t delta = raw - offset_;
   weight = (float)delta / scale_;
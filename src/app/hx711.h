@@ -1,33 +1,131 @@
 #pragma once
 
 #include <Arduino.h>
+#include <driver/spi_master.h>
+
+#include "app/load_cell_adc.h"
 
 namespace aiw {
 
 struct Hx711Pins {
   int dout;
   int sck;
+  int rate = -1;
+};
+
+enum class Hx711ReadMode : uint8_t {
+  BitBang = 0,
+  Spi = 1,
+};
+
+// Values are the number of SCK pulses per read, which selects the next conversion.
+enum class Hx711Gain : uint8_t {
+  A128 = 25,
+  B32 = 26,
+  A64 = 27,
 };
 
-class Hx711 {
+enum class Hx711Rate : uint8_t {
+  Sps10 = 10,
+  Sps80 = 80,
+};
+
+inline int hx711GainFactor(Hx711Gain gain) {
+  switch (gain) {
+    case Hx711Gain::A64: return 64;
+    case Hx711Gain::B32: return 32;
+    default: return 128;
+  }
+}
+
+inline Hx711Gain hx711GainForFactor(int gain) {
+  if (gain == 64) return Hx711Gain::A64;
+  if (gain == 32) return Hx711Gain::B32;
+  return Hx711Gain::A128;
+}
+
+inline bool hx711GainSupported(int gain) {
+  return gain == 128 || gain == 64 || gain == 32;
+}
+
+inline Hx711Rate hx711RateForSps(int sps) {
+  return sps >= 80 ? Hx711Rate::Sps80 : Hx711Rate::Sps10;
+}
+
+inline uint32_t hx711ConversionPeriodUs(Hx711Rate rate) {
+  return 1000000u / (uint32_t)rate;
+}
+
+inline uint32_t hx711ConversionTimeoutMs(Hx711Rate rate) {
+  return hx711ConversionPeriodUs(rate) * 2u / 1000u + 10u;
+}
+
+inline int hx711AverageSamples(Hx711Rate rate) {
+  return rate == Hx711Rate::Sps80 ? 16 : 5;
+}
+
+// Datasheet output settling is 400 ms at 10 SPS and 50 ms at 80 SPS: four conversions either way.
+inline int hx711SettleSamples(Hx711Rate) {
+  return 4;
+}
+
+class Hx711 : public LoadCellAdc {
 public:
   explicit Hx711(Hx711Pins pins);
 
-  void begin();
-  int32_t readRaw(uint32_t timeoutMs);
-  int32_t readAverage(int samples, uint32_t timeoutMs);
-  void tare(int samples, uint32_t timeoutMs);
+  const char *name() const override { return "hx711"; }
+  void begin() override;
+  bool setReadMode(Hx711ReadMode mode);
+  Hx711ReadMode readMode() const;
+  void setGain(Hx711Gain gain);
+  Hx711Gain gain() const;
+  bool setRate(Hx711Rate rate);
+  Hx711Rate rate() const;
+  bool hasRatePin() const;
+
+  bool setPgaGain(int gain) override;
+  int pgaGain() const override { return hx711GainFactor(gain_); }
+  bool setRateSps(int sps) override { return setRate(hx711RateForSps(sps)); }
+  int rateSps() const override { return (int)rate_; }
+  bool hasRateControl() const override { return hasRatePin(); }
+  void powerDown() override;
+  void powerUp() override;
+
+  uint32_t conversionPeriodUs() const override;
+  uint32_t conversionTimeoutMs() const override;
+  int averageSamples() const override;
+  int settleSamples() const;
+  bool settling() const override;
+  bool isReady() const override;
+  int32_t readRaw();
+  int32_t readRaw(uint32_t timeoutMs) override;
+  int32_t readConversion() override;
+  int32_t readAverage(int samples, uint32_t timeoutMs) override;
+  void tare(int samples, uint32_t timeoutMs) override;
+
+  int readyPinCount() const override { return 1; }
+  int readyPin(int) const override { return pins_.dout; }
 
-  void setScale(float scale);
-  float scale() const;
-  int32_t offset() const;
+  void setScale(float scale) override;
+  float scale() const override;
+  void setOffset(int32_t offset) override;
+  int32_t offset() const override;
+  int doutPin() const;
 
   bool readWeight(float &weight);
 
 private:
-  bool isReady() const;
+  int32_t readBitBang();
+  int32_t readSpi();
+  bool spiAttach();
+  void spiDetach();
 
   Hx711Pins pins_;
+  Hx711ReadMode mode_{Hx711ReadMode::BitBang};
+  volatile Hx711Gain gain_{Hx711Gain::A128};
+  Hx711Rate rate_{Hx711Rate::Sps10};
+  volatile uint8_t settleRemaining_{0};
+  spi_device_handle_t spiDev_{nullptr};
   int32_t offset_{0};
   float scale_{1000.0f};
 };
@@ -0,0 +1,281 @@
+#include "app/hx711_array.h"
+
+#include <soc/gpio_reg.h>
+#include <soc/soc.h>
+
+namespace aiw {
+
+Hx711Array::Hx711Array(Hx711ArrayPins pins) : pins_(pins) {
+  count_ = pins_.count;
+  if (count_ < 1) count_ = 1;
+  if (count_ > MaxChannels) count_ = MaxChannels;
+}
+
+void Hx711Array::begin() {
+  for (int i = 0; i < count_; ++i) pinMode(pins_.dout[i], INPUT_PULLUP);
+  pinMode(pins_.sck, OUTPUT);
+  digitalWrite(pins_.sck, LOW);
+  if (pins_.rate >= 0) {
+    pinMode(pins_.rate, OUTPUT);
+    digitalWrite(pins_.rate, rate_ == Hx711Rate::Sps80 ? HIGH : LOW);
+  }
+}
+
+int Hx711Array::channelCount() const {
+  return count_;
+}
+
+uint32_t Hx711Array::inputBits(uint32_t in0, uint32_t in1, int ch) const {
+  int pin = pins_.dout[ch];
+  return pin < 32 ? (in0 >> pin) & 0x01u : (in1 >> (pin - 32)) & 0x01u;
+}
+
+uint32_t Hx711Array::readyMask() const {
+  uint32_t in0 = REG_READ(GPIO_IN_REG);
+  uint32_t in1 = REG_READ(GPIO_IN1_REG);
+  uint32_t mask = 0;
+  for (int i = 0; i < count_; ++i) {
+    if (!inputBits(in0, in1, i)) mask |= 1u << i;
+  }
+  return mask;
+}
+
+bool Hx711Array::isReady() const {
+  return readyMask() == (1u << count_) - 1u;
+}
+
+void Hx711Array::sckWrite(bool high) const {
+  int pin = pins_.sck;
+  if (pin < 32) {
+    REG_WRITE(high ? GPIO_OUT_W1TS_REG : GPIO_OUT_W1TC_REG, 1u << pin);
+  } else {
+    REG_WRITE(high ? GPIO_OUT1_W1TS_REG : GPIO_OUT1_W1TC_REG, 1u << (pin - 32));
+  }
+}
+
+// The pulse train takes about 55 us and runs with interrupts off: a preemption or a
+// flash-write stall could otherwise hold SCK high past 60 us and power every channel down.
+bool Hx711Array::readConversions(int32_t *raw) {
+  if (!isReady()) return false;
+  uint32_t value[MaxChannels] = {0};
+  portENTER_CRITICAL(&mux_);
+  for (int bit = 0; bit < 24; ++bit) {
+    sckWrite(true);
+    delayMicroseconds(1);
+    uint32_t in0 = REG_READ(GPIO_IN_REG);
+    uint32_t in1 = REG_READ(GPIO_IN1_REG);
+    sckWrite(false);
+    for (int i = 0; i < count_; ++i) value[i] = (value[i] << 1) | inputBits(in0, in1, i);
+    delayMicroseconds(1);
+  }
+  int extra = (int)gain_ - 24;
+  for (int i = 0; i < extra; ++i) {
+    sckWrite(true);
+    delayMicroseconds(1);
+    sckWrite(false);
+    delayMicroseconds(1);
+  }
+  portEXIT_CRITICAL(&mux_);
+  for (int i = 0; i < count_; ++i) {
+    if (value[i] & 0x800000) value[i] |= 0xFF000000;
+    raw[i] = (int32_t)value[i];
+    lastRaw_[i] = raw[i];
+  }
+  return true;
+}
+
+int32_t Hx711Array::combine(const int32_t *raw) const {
+  int64_t sum = 0;
+  for (int i = 0; i < count_; ++i) sum += (int64_t)(raw[i] - offsets_[i]) * scalesQ16_[i];
+  return (int32_t)(sum >> 16);
+}
+
+// Returns the tared, channel-scaled sum, or INT32_MIN while settling after a gain or rate change.
+int32_t Hx711Array::readConversion() {
+  int32_t raw[MaxChannels];
+  if (!readConversions(raw)) return INT32_MIN;
+  if (settleRemaining_ > 0) {
+    settleRemaining_ = settleRemaining_ - 1;
+    return INT32_MIN;
+  }
+  return combine(raw);
+}
+
+int32_t Hx711Array::readRaw() {
+  return readRaw(conversionTimeoutMs());
+}
+
+int32_t Hx711Array::readRaw(uint32_t timeoutMs) {
+  uint32_t start = millis();
+  for (;;) {
+    while (!isReady()) {
+      if (millis() - start > timeoutMs) return INT32_MIN;
+      delay(1);
+    }
+    bool discard = settling();
+    int32_t v = readConversion();
+    if (!discard) return v;
+    start = millis();
+  }
+}
+
+int32_t Hx711Array::readAverage(int samples, uint32_t timeoutMs) {
+  if (samples < 1) samples = 1;
+  int64_t sum = 0;
+  int got = 0;
+  for (int i = 0; i < samples; ++i) {
+    int32_t v = readRaw(timeoutMs);
+    if (v == INT32_MIN) continue;
+    sum += v;
+    ++got;
+  }
+  if (got == 0) return INT32_MIN;
+  return (int32_t)(sum / got);
+}
+
+void Hx711Array::tare(int samples, uint32_t timeoutMs) {
+  if (samples < 1) samples = 1;
+  int64_t sum[MaxChannels] = {0};
+  int got = 0;
+  for (int n = 0; n < samples; ++n) {
+    uint32_t start = millis();
+    bool ready = true;
+    while (!isReady()) {
+      if (millis() - start > timeoutMs) {
+        ready = false;
+        break;
+      }
+      delay(1);
+    }
+    if (!ready) continue;
+    int32_t raw[MaxChannels];
+    if (!readConversions(raw)) continue;
+    if (settleRemaining_ > 0) {
+      settleRemaining_ = settleRemaining_ - 1;
+      n--;
+      continue;
+    }
+    for (int i = 0; i < count_; ++i) sum[i] += raw[i];
+    ++got;
+  }
+  if (got == 0) return;
+  for (int i = 0; i < count_; ++i) offsets_[i] = (int32_t)(sum[i] / got);
+  offset_ = 0;
+}
+
+void Hx711Array::setChannelOffset(int ch, int32_t offset) {
+  if (ch < 0 || ch >= count_) return;
+  offsets_[ch] = offset;
+}
+
+int32_t Hx711Array::channelOffset(int ch) const {
+  if (ch < 0 || ch >= count_) return 0;
+  return offsets_[ch];
+}
+
+// Relative gain applied to one corner before summing; 1.0 leaves it unchanged.
+void Hx711Array::setChannelScale(int ch, float scale) {
+  if (ch < 0 || ch >= count_ || scale <= 0.0f) return;
+  scalesQ16_[ch] = (int32_t)(scale * 65536.0f + 0.5f);
+}
+
+float Hx711Array::channelScale(int ch) const {
+  if (ch < 0 || ch >= count_) return 0.0f;
+  return (float)scalesQ16_[ch] / 65536.0f;
+}
+
+int32_t Hx711Array::lastRaw(int ch) const {
+  if (ch < 0 || ch >= count_) return 0;
+  return lastRaw_[ch];
+}
+
+void Hx711Array::setScale(float scale) {
+  if (scale <= 0.0f) return;
+  scale_ = scale;
+}
+
+float Hx711Array::scale() const {
+  return scale_;
+}
+
+// Residual offset of the summed output, e.g. from zero tracking; tare() clears it.
+void Hx711Array::setOffset(int32_t offset) {
+  offset_ = offset;
+}
+
+int32_t Hx711Array::offset() const {
+  return offset_;
+}
+
+int Hx711Array::doutPin(int ch) const {
+  if (ch < 0 || ch >= count_) return -1;
+  return pins_.dout[ch];
+}
+
+void Hx711Array::setGain(Hx711Gain gain) {
+  if (gain == gain_) return;
+  gain_ = gain;
+  settleRemaining_ = (uint8_t)(hx711SettleSamples(rate_) + 1);
+}
+
+Hx711Gain Hx711Array::gain() const {
+  return gain_;
+}
+
+bool Hx711Array::setPgaGain(int gain) {
+  setGain(hx711GainForFactor(gain));
+  return hx711GainSupported(gain);
+}
+
+// The shared SCK powers every channel down and up together.
+void Hx711Array::powerDown() {
+  sckWrite(true);
+  delayMicroseconds(80);
+}
+
+void Hx711Array::powerUp() {
+  sckWrite(false);
+  settleRemaining_ = (uint8_t)(hx711SettleSamples(rate_) + 1);
+}
+
+bool Hx711Array::setRate(Hx711Rate rate) {
+  if (rate == rate_) return true;
+  rate_ = rate;
+  if (pins_.rate < 0) return false;
+  digitalWrite(pins_.rate, rate_ == Hx711Rate::Sps80 ? HIGH : LOW);
+  settleRemaining_ = (uint8_t)hx711SettleSamples(rate_);
+  return true;
+}
+
+Hx711Rate Hx711Array::rate() const {
+  return rate_;
+}
+
+bool Hx711Array::hasRatePin() const {
+  return pins_.rate >= 0;
+}
+
+uint32_t Hx711Array::conversionPeriodUs() const {
+  return hx711ConversionPeriodUs(rate_);
+}
+
+uint32_t Hx711Array::conversionTimeoutMs() const {
+  return hx711ConversionTimeoutMs(rate_);
+}
+
+int Hx711Array::averageSamples() const {
+  return hx711AverageSamples(rate_);
+}
+
+bool Hx711Array::settling() const {
+  return settleRemaining_ > 0;
+}
+
+bool Hx711Array::readWeight(float &weight) {
+  int32_t sum = readAverage(averageSamples(), conversionTimeoutMs());
+  if (sum == INT32_MIN) return false;
+  weight = (float)(sum - offset_) / scale_;
+  return true;
+}
+
+}  // namespace aiw
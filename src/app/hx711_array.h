@@ -0,0 +1,92 @@
+#pragma once
+
+#include <Arduino.h>
+
+#include "app/hx711.h"
+
+namespace aiw {
+
+struct Hx711ArrayPins {
+  int sck;
+  int dout[4];
+  int count;
+  int rate = -1;
+};
+
+// Several HX711s on one shared SCK. Every clock edge samples all DOUT lines
+// with a single GPIO input register read, so N conversions cost one read.
+class Hx711Array : public LoadCellAdc {
+public:
+  static constexpr int MaxChannels = 4;
+
+  explicit Hx711Array(Hx711ArrayPins pins);
+
+  const char *name() const override { return "hx711_array"; }
+  void begin() override;
+  int channelCount() const;
+  uint32_t readyMask() const;
+  bool isReady() const override;
+
+  bool readConversions(int32_t *raw);
+  int32_t readConversion() override;
+  int32_t readRaw();
+  int32_t readRaw(uint32_t timeoutMs) override;
+  int32_t readAverage(int samples, uint32_t timeoutMs) override;
+  void tare(int samples, uint32_t timeoutMs) override;
+
+  void setChannelOffset(int ch, int32_t offset);
+  int32_t channelOffset(int ch) const;
+  void setChannelScale(int ch, float scale);
+  float channelScale(int ch) const;
+  int32_t lastRaw(int ch) const;
+
+  void setScale(float scale) override;
+  float scale() const override;
+  void setOffset(int32_t offset) override;
+  int32_t offset() const override;
+  int doutPin(int ch = 0) const;
+
+  void setGain(Hx711Gain gain);
+  Hx711Gain gain() const;
+  bool setRate(Hx711Rate rate);
+  Hx711Rate rate() const;
+  bool hasRatePin() const;
+
+  bool setPgaGain(int gain) override;
+  int pgaGain() const override { return hx711GainFactor(gain_); }
+  bool setRateSps(int sps) override { return setRate(hx711RateForSps(sps)); }
+  int rateSps() const override { return (int)rate_; }
+  bool hasRateControl() const override { return hasRatePin(); }
+  void powerDown() override;
+  void powerUp() override;
+
+  uint32_t conversionPeriodUs() const override;
+  uint32_t conversionTimeoutMs() const override;
+  int averageSamples() const override;
+  bool settling() const override;
+
+  // Every DOUT must be low before the shared SCK clocks a conversion out.
+  int readyPinCount() const override { return count_; }
+  int readyPin(int i) const override { return doutPin(i); }
+
+  bool readWeight(float &weight);
+
+private:
+  void sckWrite(bool high) const;
+  uint32_t inputBits(uint32_t in0, uint32_t in1, int ch) const;
+  int32_t combine(const int32_t *raw) const;
+
+  Hx711ArrayPins pins_;
+  int count_{0};
+  volatile Hx711Gain gain_{Hx711Gain::A128};
+  Hx711Rate rate_{Hx711Rate::Sps10};
+  volatile uint8_t settleRemaining_{0};
+  int32_t offsets_[MaxChannels] = {0};
+  int32_t scalesQ16_[MaxChannels] = {65536, 65536, 65536, 65536};
+  int32_t lastRaw_[MaxChannels] = {0};
+  int32_t offset_{0};
+  float scale_{1000.0f};
+  portMUX_TYPE mux_ = portMUX_INITIALIZER_UNLOCKED;
+};
+
+}  // namespace aiw
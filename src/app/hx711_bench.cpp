@@ -0,0 +1,61 @@
+#include "app/hx711_bench.h"
+
+#include <esp_timer.h>
+
+namespace aiw {
+
+const char *hx711ReadModeName(Hx711ReadMode mode) {
+  switch (mode) {
+    case Hx711ReadMode::BitBang: return "bitbang";
+    case Hx711ReadMode::Spi: return "spi";
+    default: return "?";
+  }
+}
+
+bool runHx711ReadBench(Hx711 &hx, Hx711ReadMode mode, int samples, int32_t glitchDelta, Hx711BenchResult &out) {
+  out = Hx711BenchResult{};
+  Hx711ReadMode prevMode = hx.readMode();
+  if (!hx.setReadMode(mode)) return false;
+
+  uint64_t sumUs = 0;
+  bool hasPrev = false;
+  int32_t prev = 0;
+  for (int i = 0; i < samples; ++i) {
+    uint32_t start = millis();
+    bool ready = true;
+    while (!hx.isReady()) {
+      if (millis() - start > 500) {
+        ready = false;
+        break;
+      }
+      delay(1);
+    }
+    if (!ready) {
+      out.timeouts++;
+      continue;
+    }
+    int64_t t0 = esp_timer_get_time();
+    int32_t v = hx.readConversion();
+    uint32_t us = (uint32_t)(esp_timer_get_time() - t0);
+    if (v == INT32_MIN) {
+      out.timeouts++;
+      continue;
+    }
+    if (out.reads == 0 || us < out.minUs) out.minUs = us;
+    if (us > out.maxUs) out.maxUs = us;
+    sumUs += us;
+    out.reads++;
+    if (hasPrev) {
+      int32_t diff = v - prev;
+      if (diff < 0) diff = -diff;
+      if (diff > glitchDelta) out.glitches++;
+    }
+    hasPrev = true;
+    prev = v;
+  }
+  if (out.reads > 0) out.avgUs = (uint32_t)(sumUs / (uint64_t)out.reads);
+  hx.setReadMode(prevMode);
+  return true;
+}
+
+}  // namespace aiw
@@ -0,0 +1,21 @@
+#pragma once
+
+#include <Arduino.h>
+
+#include "app/hx711.h"
+
+namespace aiw {
+
+struct Hx711BenchResult {
+  int reads = 0;
+  int timeouts = 0;
+  int glitches = 0;
+  uint32_t minUs = 0;
+  uint32_t maxUs = 0;
+  uint32_t avgUs = 0;
+};
+
+bool runHx711ReadBench(Hx711 &hx, Hx711ReadMode mode, int samples, int32_t glitchDelta, Hx711BenchResult &out);
+const char *hx711ReadModeName(Hx711ReadMode mode);
+
+}  // namespace aiw
@@ -0,0 +1,177 @@
+#include "app/hx711_sampler.h"
+
+#include <driver/gpio.h>
+
+namespace aiw {
+
+// Every ready pin gets the edge interrupt; the task reads once the converter reports
+// ready. A converter without ready pins is polled once per conversion period.
+// Fails while an earlier task is still alive, e.g. after end() timed out.
+bool Hx711Sampler::begin(LoadCellAdc &adc, uint32_t periodMs) {
+  if (task_) return false;
+  adc_ = &adc;
+  pinCount_ = adc.readyPinCount();
+  if (pinCount_ > MaxReadyPins) pinCount_ = MaxReadyPins;
+  for (int i = 0; i < pinCount_; ++i) pins_[i] = adc.readyPin(i);
+  return start(periodMs ? periodMs * 1000u : adc.conversionPeriodUs());
+}
+
+bool Hx711Sampler::start(uint32_t periodUs) {
+  periodUs_ = periodUs;
+  hasLastSample_ = false;
+  stopRequested_ = false;
+  suspendRequested_ = false;
+  idle_ = false;
+
+  for (int i = 0; i < pinCount_; ++i) {
+    attachInterruptArg(digitalPinToInterrupt(pins_[i]), onDoutFalling, this, FALLING);
+  }
+  BaseType_t ok = xTaskCreatePinnedToCore(taskEntry, "aiw_hx711", 3072, this, 5, &task_, 1);
+  if (ok != pdPASS) {
+    task_ = nullptr;
+    for (int i = 0; i < pinCount_; ++i) detachInterrupt(digitalPinToInterrupt(pins_[i]));
+    return false;
+  }
+  return true;
+}
+
+// Returns false if the task has not exited within 500 ms; it still stops on its own.
+bool Hx711Sampler::end() {
+  if (!task_) return true;
+  stopRequested_ = true;
+  xTaskNotifyGive(task_);
+  uint32_t start = millis();
+  while (task_ && millis() - start < 500) delay(1);
+  for (int i = 0; i < pinCount_; ++i) detachInterrupt(digitalPinToInterrupt(pins_[i]));
+  return task_ == nullptr;
+}
+
+void Hx711Sampler::suspend() {
+  if (!task_) return;
+  suspendRequested_ = true;
+  xTaskNotifyGive(task_);
+  uint32_t start = millis();
+  while (!idle_ && millis() - start < 500) delay(1);
+}
+
+void Hx711Sampler::resume() {
+  if (!task_) return;
+  suspendRequested_ = false;
+  xTaskNotifyGive(task_);
+}
+
+bool Hx711Sampler::pop(Hx711Sample &out) {
+  return ring_.pop(out);
+}
+
+size_t Hx711Sampler::available() const {
+  return ring_.size();
+}
+
+void Hx711Sampler::flush() {
+  Hx711Sample s;
+  while (ring_.pop(s)) {
+  }
+}
+
+Hx711SamplerStats Hx711Sampler::stats() const {
+  Hx711SamplerStats s;
+  s.samples = samples_;
+  s.dropped = dropped_;
+  s.overruns = overruns_;
+  s.timeouts = timeouts_;
+  s.readErrors = readErrors_;
+  s.queued = (uint32_t)ring_.size();
+  return s;
+}
+
+void Hx711Sampler::resetStats() {
+  samples_ = 0;
+  dropped_ = 0;
+  overruns_ = 0;
+  timeouts_ = 0;
+  readErrors_ = 0;
+}
+
+void IRAM_ATTR Hx711Sampler::onDoutFalling(void *arg) {
+  auto *self = static_cast<Hx711Sampler *>(arg);
+  BaseType_t woken = pdFALSE;
+  if (self->task_) vTaskNotifyGiveFromISR(self->task_, &woken);
+  if (woken) portYIELD_FROM_ISR();
+}
+
+// Re-arming sets the edge type again: a read-mode change may hand the pin to the SPI
+// driver and back, and a pin reset on the way clears it.
+void Hx711Sampler::armInterrupt(bool on) {
+  for (int i = 0; i < pinCount_; ++i) {
+    gpio_num_t pin = (gpio_num_t)pins_[i];
+    if (on) {
+      gpio_set_intr_type(pin, GPIO_INTR_NEGEDGE);
+      gpio_intr_enable(pin);
+    } else {
+      gpio_intr_disable(pin);
+    }
+  }
+}
+
+void Hx711Sampler::taskEntry(void *pv) {
+  static_cast<Hx711Sampler *>(pv)->run();
+}
+
+void Hx711Sampler::run() {
+  const bool polled = pinCount_ == 0;
+  TickType_t waitTicks = pdMS_TO_TICKS(polled ? periodUs_ / 1000u : (periodUs_ / 1000u) * 2u + 10u);
+  if (waitTicks == 0) waitTicks = 1;
+  while (!stopRequested_) {
+    if (suspendRequested_) {
+      if (!idle_) {
+        armInterrupt(false);
+        idle_ = true;
+      }
+      ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(20));
+      continue;
+    }
+    if (idle_) {
+      idle_ = false;
+      hasLastSample_ = false;
+      armInterrupt(true);
+    }
+
+    uint32_t notified = ulTaskNotifyTake(pdTRUE, waitTicks);
+    if (stopRequested_ || suspendRequested_) continue;
+    if (!adc_->isReady()) {
+      if (notified == 0 && !polled) timeouts_++;
+      continue;
+    }
+
+    // DOUT toggles while the bits are clocked out; keep those edges from re-waking us.
+    armInterrupt(false);
+    uint32_t nowUs = micros();
+    // Conversions after a gain, rate or power change are discarded by design, not errors.
+    bool discard = adc_->settling();
+    int32_t raw = adc_->readConversion();
+    ulTaskNotifyTake(pdTRUE, 0);
+    armInterrupt(true);
+    if (raw == INT32_MIN) {
+      if (!discard) readErrors_++;
+      hasLastSample_ = false;
+      continue;
+    }
+
+    if (hasLastSample_) {
+      uint32_t dt = nowUs - lastSampleUs_;
+      if (dt > periodUs_ + periodUs_ / 2) {
+        overruns_ += (dt + periodUs_ / 2) / periodUs_ - 1;
+      }
+    }
+    hasLastSample_ = true;
+    lastSampleUs_ = nowUs;
+    samples_++;
+    if (!ring_.push(Hx711Sample{nowUs, raw})) dropped_++;
+  }
+  armInterrupt(false);
+  task_ = nullptr;
+  vTaskDelete(nullptr);
+}
+
+}  // namespace aiw
@@ -0,0 +1,71 @@
+#pragma once
+
+#include <Arduino.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+
+#include "app/load_cell_adc.h"
+#include "app/spsc_ring.h"
+
+namespace aiw {
+
+struct Hx711Sample {
+  uint32_t timestampUs;
+  int32_t raw;
+};
+
+struct Hx711SamplerStats {
+  uint32_t samples;
+  uint32_t dropped;
+  uint32_t overruns;
+  uint32_t timeouts;
+  uint32_t readErrors;
+  uint32_t queued;
+};
+
+class Hx711Sampler {
+ public:
+  static constexpr size_t RingSize = 64;
+
+  static constexpr int MaxReadyPins = 4;
+
+  bool begin(LoadCellAdc &adc, uint32_t periodMs = 0);
+  bool end();
+
+  bool pop(Hx711Sample &out);
+  size_t available() const;
+  void flush();
+
+  void suspend();
+  void resume();
+  bool isRunning() const { return task_ != nullptr; }
+
+  Hx711SamplerStats stats() const;
+  void resetStats();
+
+ private:
+  static void taskEntry(void *pv);
+  static void onDoutFalling(void *arg);
+  void run();
+  bool start(uint32_t periodUs);
+  void armInterrupt(bool on);
+
+  LoadCellAdc *adc_ = nullptr;
+  int pins_[MaxReadyPins] = {-1, -1, -1, -1};
+  int pinCount_ = 0;
+  TaskHandle_t task_ = nullptr;
+  uint32_t periodUs_ = 100000;
+  uint32_t lastSampleUs_ = 0;
+  bool hasLastSample_ = false;
+  SpscRing<Hx711Sample, RingSize> ring_;
+  volatile bool stopRequested_ = false;
+  volatile bool suspendRequested_ = false;
+  volatile bool idle_ = false;
+  volatile uint32_t samples_ = 0;
+  volatile uint32_t dropped_ = 0;
+  volatile uint32_t overruns_ = 0;
+  volatile uint32_t timeouts_ = 0;
+  volatile uint32_t readErrors_ = 0;
+};
+
+}  // namespace aiw
@@ -0,0 +1,53 @@
+#pragma once
+
+#include <stdint.h>
+
+namespace aiw {
+
+// A load-cell converter as the weighing code sees it. Rates are samples per second and
+// gains the PGA factor, so converters other than the HX711 (e.g. a NAU7802 on I2C) fit
+// the same calls. Conversions are raw counts; offset and scale turn them into kg.
+class LoadCellAdc {
+public:
+  virtual ~LoadCellAdc() = default;
+
+  virtual const char *name() const = 0;
+  virtual void begin() = 0;
+
+  // A conversion can be read without waiting.
+  virtual bool isReady() const = 0;
+  // Reads the pending conversion; INT32_MIN while the output settles after a change.
+  virtual int32_t readConversion() = 0;
+  virtual bool settling() const = 0;
+  // Blocking reads that skip settling conversions; INT32_MIN on timeout.
+  virtual int32_t readRaw(uint32_t timeoutMs) = 0;
+  virtual int32_t readAverage(int samples, uint32_t timeoutMs) = 0;
+  virtual void tare(int samples, uint32_t timeoutMs) = 0;
+
+  // False when the converter cannot apply the setting; the value is still recorded so
+  // a strapped rate or gain can be described.
+  virtual bool setPgaGain(int gain) = 0;
+  virtual int pgaGain() const = 0;
+  virtual bool setRateSps(int sps) = 0;
+  virtual int rateSps() const = 0;
+  virtual bool hasRateControl() const = 0;
+
+  virtual void powerDown() = 0;
+  virtual void powerUp() = 0;
+
+  virtual uint32_t conversionPeriodUs() const = 0;
+  virtual uint32_t conversionTimeoutMs() const = 0;
+  // Conversions to average for a tare or calibration read.
+  virtual int averageSamples() const = 0;
+
+  // Pins that go low when a conversion is ready; none means the reader polls.
+  virtual int readyPinCount() const = 0;
+  virtual int readyPin(int i) const = 0;
+
+  virtual void setScale(float scale) = 0;
+  virtual float scale() const = 0;
+  virtual void setOffset(int32_t offset) = 0;
+  virtual int32_t offset() const = 0;
+};
+
+}  // namespace aiw
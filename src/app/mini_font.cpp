@@ -1,8 +1,10 @@
 #include "app/mini_font.h"
 
+#include <string.h>
+
 namespace aiw {
 
-static bool glyph5x7(char c, uint8_t out[7]) {
+bool glyph5x7(char c, uint8_t out[7]) {
   if (c >= 'a' && c <= 'z') c = (char)(c - 'a' + 'A');
   switch (c) {
     case ' ': {
@@ -92,24 +94,4 @@ static bool glyph5x7(char c, uint8_t out[7]) {
   }
 }
 
-void drawText5x7(DisplaySt7789 &display, int x, int y, const char *text, uint16_t fg, uint16_t bg, int scale) {
-  if (!text) return;
-  if (scale < 1) scale = 1;
-  int cx = x;
-  uint8_t rows[7];
-  while (*text) {
-    char c = *text++;
-    if (!glyph5x7(c, rows)) {
-      for (int i = 0; i < 7; ++i) rows[i] = 0;
-    }
-    for (int r = 0; r < 7; ++r) {
-      for (int col = 0; col < 5; ++col) {
-        bool on = (rows[r] & (1u << (4 - col))) != 0;
-        display.fillRect(cx + col * scale, y + r * scale, scale, scale, on ? fg : bg);
-      }
-    }
-    cx += (6 * scale);
-  }
-}
-
-}
+}  // namespace aiw
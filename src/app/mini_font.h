@@ -1,11 +1,11 @@
 #pragma once
 
-#include <Arduino.h>
-#include "app/display_st7789.h"
+#include <stdint.h>
 
 namespace aiw {
 
-void drawText5x7(DisplaySt7789 &display, int x, int y, const char *text, uint16_t fg, uint16_t bg, int scale = 1);
-
-}
+// Rows of a 5x7 glyph, columns in bits 4..0 with the leftmost in bit 4. Lower case maps
+// to upper case; false for characters the font lacks.
+bool glyph5x7(char c, uint8_t out[7]);
 
+}  // namespace aiw
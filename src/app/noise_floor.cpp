@@ -0,0 +1,95 @@
+#include "app/noise_floor.h"
+
+namespace aiw {
+
+static int32_t maxI32(int32_t a, int32_t b) {
+  return a > b ? a : b;
+}
+
+NoiseThresholds deriveNoiseThresholds(float sigmaCounts, float countsPerKg, float stepKg) {
+  float step = countsPerKg * stepKg;
+  if (step < 1.0f) step = 1.0f;
+  int32_t s = (int32_t)(step + 0.5f);
+  int32_t sigma = (int32_t)(sigmaCounts + 0.5f);
+  if (sigma < 1) sigma = 1;
+  NoiseThresholds th;
+  th.zeroSnapCounts = maxI32(5 * sigma, s);
+  th.stableBaseCounts = maxI32(6 * sigma, s / 16);
+  th.stableMaxCounts = maxI32(4 * th.stableBaseCounts, s / 4);
+  th.payTriggerCounts = maxI32(4 * th.zeroSnapCounts, 10 * sigma);
+  th.glitchCounts = maxI32(25 * sigma, 10 * s);
+  return th;
+}
+
+void NoiseFloorEstimator::configure(int32_t bandCounts, int windowSamples, uint8_t minWindows) {
+  if (windowSamples < 8) windowSamples = 8;
+  if (windowSamples > MaxWindow) windowSamples = MaxWindow;
+  if (minWindows < 1) minWindows = 1;
+  band_ = bandCounts;
+  length_ = windowSamples;
+  minWindows_ = minWindows;
+  count_ = 0;
+  sum_ = 0;
+}
+
+void NoiseFloorEstimator::reset() {
+  count_ = 0;
+  sum_ = 0;
+  sigma_ = 0.0f;
+  windows_ = 0;
+  rejected_ = 0;
+}
+
+// Restores a persisted estimate; new windows keep refining it.
+void NoiseFloorEstimator::seed(float sigma, uint32_t windows) {
+  if (sigma <= 0.0f || windows == 0) return;
+  sigma_ = sigma;
+  windows_ = windows;
+}
+
+bool NoiseFloorEstimator::push(int32_t delta) {
+  samples_[count_++] = delta;
+  sum_ += delta;
+  if (count_ < length_) return false;
+  int64_t mean = sum_ / count_;
+  count_ = 0;
+  sum_ = 0;
+  if (mean > band_ || mean < -band_) {
+    rejected_++;
+    return false;
+  }
+  float s = windowSigma();
+  if (windows_ == 0) {
+    sigma_ = s;
+  } else {
+    // Early windows move the estimate quickly; later ones only refine it.
+    uint32_t n = windows_ < 16 ? windows_ + 1 : 16;
+    sigma_ += (s - sigma_) / (float)n;
+  }
+  windows_++;
+  return true;
+}
+
+float NoiseFloorEstimator::windowSigma() const {
+  int n = length_ - 1;
+  int32_t d[MaxWindow];
+  for (int i = 0; i < n; ++i) {
+    int32_t v = samples_[i + 1] - samples_[i];
+    d[i] = v < 0 ? -v : v;
+  }
+  for (int i = 1; i < n; ++i) {
+    int32_t key = d[i];
+    int j = i - 1;
+    while (j >= 0 && d[j] > key) {
+      d[j + 1] = d[j];
+      --j;
+    }
+    d[j + 1] = key;
+  }
+  float mad = (n & 1) ? (float)d[n / 2] : 0.5f * (float)(d[n / 2 - 1] + d[n / 2]);
+  // Differences of white noise have sigma * sqrt(2) spread; their absolute values
+  // have median 0.6745 * sigma * sqrt(2), so sigma = mad / 0.954.
+  return mad / 0.954f;
+}
+
+}  // namespace aiw
@@ -0,0 +1,53 @@
+#pragma once
+
+#include <stdint.h>
+
+namespace aiw {
+
+struct NoiseThresholds {
+  int32_t zeroSnapCounts;
+  int32_t stableBaseCounts;
+  int32_t stableMaxCounts;
+  int32_t payTriggerCounts;
+  int32_t glitchCounts;
+};
+
+// Thresholds in counts for a given per-sample noise sigma (after averaging) and
+// display step, never looser than needed to clear the noise.
+NoiseThresholds deriveNoiseThresholds(float sigmaCounts, float countsPerKg, float stepKg);
+
+// Estimates the HX711 noise floor from the raw conversion stream while the platform
+// is empty. Each window whose mean stays inside +-bandCounts gives a robust sigma from
+// the MAD of first differences (drift-free, like an Allan deviation at tau = 1 sample);
+// loaded windows are discarded. Window sigmas are smoothed into sigma().
+class NoiseFloorEstimator {
+public:
+  static constexpr int MaxWindow = 64;
+
+  void configure(int32_t bandCounts, int windowSamples = 32, uint8_t minWindows = 4);
+  void setBand(int32_t bandCounts) { band_ = bandCounts; }
+  void reset();
+  void seed(float sigma, uint32_t windows);
+
+  bool push(int32_t delta);
+
+  bool ready() const { return windows_ >= minWindows_; }
+  float sigma() const { return sigma_; }
+  uint32_t windows() const { return windows_; }
+  uint32_t rejectedWindows() const { return rejected_; }
+
+private:
+  float windowSigma() const;
+
+  int32_t band_ = 400;
+  int length_ = 32;
+  uint8_t minWindows_ = 4;
+  int32_t samples_[MaxWindow] = {0};
+  int count_ = 0;
+  int64_t sum_ = 0;
+  float sigma_ = 0.0f;
+  uint32_t windows_ = 0;
+  uint32_t rejected_ = 0;
+};
+
+}  // namespace aiw
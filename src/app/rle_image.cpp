@@ -0,0 +1,54 @@
+#include "app/rle_image.h"
+
+namespace aiw {
+
+void RleDecoder::begin(const RleImage &image) {
+  image_ = &image;
+  pos_ = 0;
+  left_ = (uint32_t)(image.w > 0 ? image.w : 0) * (uint32_t)(image.h > 0 ? image.h : 0);
+  run_ = 0;
+  color_ = 0;
+}
+
+bool RleDecoder::nextRun() {
+  if (pos_ >= image_->size) return false;
+  uint8_t b = image_->data[pos_++];
+  uint8_t idx = b >> 4;
+  uint32_t n = b & 0x0Fu;
+  if (n == 15) {
+    uint32_t extra = 0;
+    int shift = 0;
+    uint8_t c = 0x80;
+    while ((c & 0x80u) && pos_ < image_->size && shift < 28) {
+      c = image_->data[pos_++];
+      extra |= (uint32_t)(c & 0x7Fu) << shift;
+      shift += 7;
+    }
+    n = 15 + extra;
+  }
+  if (idx >= image_->paletteSize) return false;
+  color_ = image_->palette[idx];
+  run_ = n + 1;
+  return true;
+}
+
+size_t RleDecoder::read(uint16_t *out, size_t max, bool swapBytes) {
+  size_t n = 0;
+  while (n < max && left_ > 0) {
+    if (run_ == 0 && !nextRun()) {
+      left_ = 0;
+      break;
+    }
+    uint16_t c = swapBytes ? (uint16_t)((color_ >> 8) | (color_ << 8)) : color_;
+    uint32_t take = run_;
+    if (take > max - n) take = (uint32_t)(max - n);
+    if (take > left_) take = left_;
+    for (uint32_t i = 0; i < take; ++i) out[n + i] = c;
+    n += take;
+    run_ -= take;
+    left_ -= take;
+  }
+  return n;
+}
+
+}  // namespace aiw
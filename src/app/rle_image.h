@@ -0,0 +1,39 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+namespace aiw {
+
+// Palette run-length RGB565, rows run on into each other. Every byte is
+// (palette index << 4) | n: n < 15 is a run of n + 1 pixels, n == 15 is followed by a
+// LEB128 count of the run length minus 16.
+struct RleImage {
+  int16_t x;
+  int16_t y;
+  int16_t w;
+  int16_t h;
+  uint8_t paletteSize;
+  const uint16_t *palette;
+  const uint8_t *data;
+  uint32_t size;
+};
+
+class RleDecoder {
+public:
+  void begin(const RleImage &image);
+  // Up to max pixels; fewer only at the end of the image or on corrupt data.
+  size_t read(uint16_t *out, size_t max, bool swapBytes);
+  uint32_t remaining() const { return left_; }
+
+private:
+  bool nextRun();
+
+  const RleImage *image_ = nullptr;
+  uint32_t pos_ = 0;
+  uint32_t left_ = 0;
+  uint32_t run_ = 0;
+  uint16_t color_ = 0;
+};
+
+}  // namespace aiw
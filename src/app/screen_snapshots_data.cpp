@@ -0,0 +1,539 @@
+// Generated by tools/screen_snapshots.cpp (make screen_snapshots); do not edit.
+#include "app/ui_screens.h"
+
+namespace aiw {
+namespace ui {
+
+static const uint16_t height0_palette[3] = {0x0000, 0xFFFF, 0xC618};
+
+static const uint8_t height0_data[627] = {
+    0x0F, 0xF2, 0x04, 0x1F, 0xAC, 0x02, 0x03, 0x1F, 0xAC, 0x02, 0x03, 0x1F, 0xAC, 0x02, 0x03, 0x1F,
+    0xAC, 0x02, 0x03, 0x1F, 0xAC, 0x02, 0x03, 0x1F, 0xAC, 0x02, 0x03, 0x1F, 0x05, 0x01, 0x12, 0x01,
+    0x1D, 0x01, 0x1F, 0x80, 0x02, 0x03, 0x1A, 0x02, 0x16, 0x01, 0x12, 0x01, 0x1D, 0x01, 0x13, 0x0D,
+    0x1D, 0x02, 0x1F, 0x0A, 0x02, 0x1F, 0xC0, 0x01, 0x03, 0x1A, 0x03, 0x14, 0x02, 0x12, 0x01, 0x1D,
+    0x01, 0x13, 0x0D, 0x1D, 0x01, 0x1F, 0x0B, 0x02, 0x1F, 0xC0, 0x01, 0x03, 0x1B, 0x03, 0x13, 0x02,
+    0x12, 0x01, 0x1D, 0x01, 0x15, 0x02, 0x15, 0x02, 0x17, 0x0F, 0x00, 0x17, 0x0F, 0x09, 0x1F, 0xB5,
+    0x01, 0x03, 0x1C, 0x03, 0x12, 0x0D, 0x17, 0x01, 0x15, 0x02, 0x15, 0x01, 0x18, 0x0F, 0x00, 0x17,
+    0x0F, 0x09, 0x1F, 0xB5, 0x01, 0x03, 0x1D, 0x02, 0x11, 0x0E, 0x13, 0x08, 0x13, 0x02, 0x13, 0x02,
+    0x18, 0x01, 0x1B, 0x01, 0x1F, 0xD6, 0x01, 0x03, 0x1E, 0x00, 0x12, 0x01, 0x14, 0x01, 0x19, 0x08,
+    0x14, 0x02, 0x10, 0x03, 0x19, 0x01, 0x1B, 0x01, 0x1F, 0xD6, 0x01, 0x03, 0x1F, 0x02, 0x02, 0x14,
+    0x01, 0x1C, 0x02, 0x18, 0x05, 0x1A, 0x01, 0x1B, 0x01, 0x1C, 0x0F, 0x00, 0x1F, 0xB9, 0x01, 0x03,
+    0x1F, 0x03, 0x00, 0x15, 0x01, 0x1D, 0x01, 0x18, 0x04, 0x1B, 0x0F, 0x00, 0x1C, 0x0F, 0x00, 0x1F,
+    0xB9, 0x01, 0x03, 0x1F, 0x03, 0x0E, 0x17, 0x01, 0x16, 0x09, 0x18, 0x0F, 0x00, 0x1C, 0x01, 0x1A,
+    0x02, 0x1F, 0xB9, 0x01, 0x03, 0x19, 0x05, 0x12, 0x0F, 0x00, 0x16, 0x01, 0x13, 0x06, 0x11, 0x06,
+    0x15, 0x01, 0x1B, 0x01, 0x1C, 0x01, 0x1A, 0x02, 0x1F, 0xB9, 0x01, 0x03, 0x19, 0x05, 0x12, 0x0F,
+    0x00, 0x16, 0x01, 0x13, 0x04, 0x15, 0x04, 0x15, 0x01, 0x1B, 0x01, 0x11, 0x02, 0x17, 0x0F, 0x00,
+    0x1F, 0xB9, 0x01, 0x03, 0x1D, 0x01, 0x16, 0x01, 0x12, 0x01, 0x1B, 0x01, 0x10, 0x01, 0x10, 0x01,
+    0x14, 0x01, 0x14, 0x00, 0x16, 0x0F, 0x00, 0x11, 0x02, 0x17, 0x0F, 0x00, 0x1F, 0xB9, 0x01, 0x03,
+    0x1D, 0x01, 0x16, 0x01, 0x12, 0x01, 0x1B, 0x04, 0x16, 0x02, 0x1C, 0x0F, 0x00, 0x10, 0x02, 0x1F,
+    0xD2, 0x01, 0x03, 0x1D, 0x01, 0x16, 0x01, 0x12, 0x01, 0x18, 0x06, 0x12, 0x0C, 0x17, 0x01, 0x1B,
+    0x01, 0x10, 0x01, 0x16, 0x0F, 0x06, 0x1F, 0xB6, 0x01, 0x03, 0x1D, 0x01, 0x15, 0x02, 0x12, 0x01,
+    0x17, 0x05, 0x14, 0x0C, 0x17, 0x01, 0x1B, 0x04, 0x16, 0x0F, 0x06, 0x1F, 0xB6, 0x01, 0x03, 0x1D,
+    0x01, 0x15, 0x02, 0x12, 0x01, 0x12, 0x01, 0x12, 0x02, 0x10, 0x01, 0x19, 0x02, 0x1C, 0x01, 0x1B,
+    0x03, 0x17, 0x01, 0x1F, 0x02, 0x01, 0x1F, 0xB6, 0x01, 0x03, 0x1D, 0x01, 0x14, 0x02, 0x13, 0x01,
+    0x12, 0x01, 0x16, 0x01, 0x19, 0x02, 0x18, 0x0F, 0x05, 0x18, 0x01, 0x1F, 0x02, 0x01, 0x1F, 0xB6,
+    0x01, 0x03, 0x1D, 0x01, 0x13, 0x03, 0x13, 0x01, 0x12, 0x01, 0x16, 0x01, 0x19, 0x02, 0x18, 0x0F,
+    0x04, 0x19, 0x01, 0x12, 0x0B, 0x12, 0x01, 0x1F, 0xB6, 0x01, 0x03, 0x1D, 0x01, 0x11, 0x04, 0x14,
+    0x06, 0x16, 0x01, 0x12, 0x0F, 0x01, 0x1F, 0x01, 0x04, 0x19, 0x01, 0x12, 0x0B, 0x12, 0x01, 0x1F,
+    0xB6, 0x01, 0x03, 0x1C, 0x03, 0x10, 0x02, 0x16, 0x06, 0x16, 0x01, 0x12, 0x0F, 0x01, 0x1F, 0x00,
+    0x05, 0x19, 0x01, 0x12, 0x01, 0x16, 0x02, 0x12, 0x01, 0x1F, 0xB6, 0x01, 0x03, 0x1B, 0x05, 0x10,
+    0x00, 0x1F, 0x06, 0x01, 0x19, 0x02, 0x1F, 0x04, 0x04, 0x11, 0x01, 0x19, 0x01, 0x12, 0x01, 0x16,
+    0x02, 0x12, 0x01, 0x1F, 0xB6, 0x01, 0x03, 0x1A, 0x03, 0x10, 0x03, 0x1F, 0x06, 0x01, 0x19, 0x02,
+    0x1F, 0x02, 0x05, 0x12, 0x01, 0x19, 0x01, 0x12, 0x0B, 0x12, 0x01, 0x1F, 0xB6, 0x01, 0x03, 0x1A,
+    0x02, 0x12, 0x0F, 0x03, 0x14, 0x02, 0x19, 0x02, 0x1D, 0x07, 0x14, 0x01, 0x19, 0x01, 0x12, 0x0A,
+    0x13, 0x01, 0x1F, 0xB6, 0x01, 0x03, 0x19, 0x02, 0x14, 0x0F, 0x01, 0x12, 0x05, 0x19, 0x02, 0x19,
+    0x08, 0x17, 0x01, 0x19, 0x01, 0x1F, 0x01, 0x02, 0x1F, 0xB6, 0x01, 0x03, 0x1A, 0x00, 0x1F, 0x0B,
+    0x03, 0x1A, 0x02, 0x19, 0x05, 0x16, 0x05, 0x19, 0x01, 0x1D, 0x05, 0x1F, 0xB6, 0x01, 0x03, 0x1F,
+    0x34, 0x00, 0x1A, 0x04, 0x1A, 0x01, 0x1D, 0x04, 0x1F, 0xB7, 0x01, 0x03, 0x1F, 0xAC, 0x02, 0x03,
+    0x1F, 0xAC, 0x02, 0x03, 0x1F, 0xAC, 0x02, 0x03, 0x1F, 0xAC, 0x02, 0x03, 0x1F, 0xAC, 0x02, 0x01,
+    0x2F, 0xB0, 0x02,
+};
+
+static const uint16_t height1_palette[2] = {0x0000, 0xFFFF};
+
+static const uint8_t height1_data[246] = {
+    0x01, 0x11, 0x01, 0x11, 0x01, 0x11, 0x01, 0x11, 0x01, 0x11, 0x01, 0x11, 0x01, 0x11, 0x01, 0x11,
+    0x01, 0x11, 0x01, 0x11, 0x01, 0x11, 0x01, 0x11, 0x01, 0x11, 0x01, 0x11, 0x01, 0x11, 0x01, 0x11,
+    0x01, 0x11, 0x01, 0x11, 0x01, 0x11, 0x01, 0x11, 0x01, 0x11, 0x01, 0x11, 0x01, 0x11, 0x01, 0x11,
+    0x01, 0x11, 0x01, 0x11, 0x01, 0x11, 0x01, 0x11, 0x01, 0x11, 0x01, 0x11, 0x01, 0x11, 0x01, 0x11,
+    0x01, 0x11, 0x01, 0x11, 0x01, 0x11, 0x01, 0x11, 0x01, 0x11, 0x01, 0x11, 0x01, 0x11, 0x01, 0x11,
+    0x01, 0x11, 0x01, 0x11, 0x01, 0x11, 0x01, 0x11, 0x01, 0x11, 0x01, 0x11, 0x01, 0x11, 0x01, 0x11,
+    0x01, 0x11, 0x01, 0x11, 0x01, 0x11, 0x01, 0x11, 0x01, 0x11, 0x01, 0x11, 0x01, 0x11, 0x01, 0x11,
+    0x01, 0x11, 0x01, 0x11, 0x01, 0x11, 0x01, 0x11, 0x01, 0x11, 0x01, 0x11, 0x01, 0x11, 0x01, 0x11,
+    0x01, 0x11, 0x01, 0x11, 0x01, 0x11, 0x01, 0x11, 0x01, 0x11, 0x01, 0x11, 0x01, 0x11, 0x01, 0x11,
+    0x01, 0x11, 0x01, 0x11, 0x01, 0x11, 0x01, 0x11, 0x01, 0x11, 0x01, 0x11, 0x01, 0x11, 0x01, 0x11,
+    0x01, 0x11, 0x01, 0x11, 0x01, 0x11, 0x01, 0x11, 0x01, 0x11, 0x01, 0x11, 0x01, 0x11, 0x01, 0x11,
+    0x01, 0x11, 0x01, 0x11, 0x01, 0x11, 0x01, 0x11, 0x01, 0x11, 0x01, 0x11, 0x01, 0x11, 0x01, 0x11,
+    0x01, 0x11, 0x01, 0x11, 0x01, 0x11, 0x01, 0x11, 0x01, 0x11, 0x01, 0x11, 0x01, 0x11, 0x01, 0x11,
+    0x01, 0x11, 0x01, 0x11, 0x01, 0x11, 0x01, 0x11, 0x01, 0x11, 0x01, 0x11, 0x01, 0x11, 0x01, 0x11,
+    0x01, 0x11, 0x01, 0x11, 0x01, 0x11, 0x01, 0x11, 0x01, 0x11, 0x01, 0x11, 0x01, 0x11, 0x01, 0x11,
+    0x01, 0x11, 0x01, 0x11, 0x01, 0x11,
+};
+
+static const uint16_t height2_palette[2] = {0xFFFF, 0x0000};
+
+static const uint8_t height2_data[246] = {
+    0x01, 0x11, 0x01, 0x11, 0x01, 0x11, 0x01, 0x11, 0x01, 0x11, 0x01, 0x11, 0x01, 0x11, 0x01, 0x11,
+    0x01, 0x11, 0x01, 0x11, 0x01, 0x11, 0x01, 0x11, 0x01, 0x11, 0x01, 0x11, 0x01, 0x11, 0x01, 0x11,
+    0x01, 0x11, 0x01, 0x11, 0x01, 0x11, 0x01, 0x11, 0x01, 0x11, 0x01, 0x11, 0x01, 0x11, 0x01, 0x11,
+    0x01, 0x11, 0x01, 0x11, 0x01, 0x11, 0x01, 0x11, 0x01, 0x11, 0x01, 0x11, 0x01, 0x11, 0x01, 0x11,
+    0x01, 0x11, 0x01, 0x11, 0x01, 0x11, 0x01, 0x11, 0x01, 0x11, 0x01, 0x11, 0x01, 0x11, 0x01, 0x11,
+    0x01, 0x11, 0x01, 0x11, 0x01, 0x11, 0x01, 0x11, 0x01, 0x11, 0x01, 0x11, 0x01, 0x11, 0x01, 0x11,
+    0x01, 0x11, 0x01, 0x11, 0x01, 0x11, 0x01, 0x11, 0x01, 0x11, 0x01, 0x11, 0x01, 0x11, 0x01, 0x11,
+    0x01, 0x11, 0x01, 0x11, 0x01, 0x11, 0x01, 0x11, 0x01, 0x11, 0x01, 0x11, 0x01, 0x11, 0x01, 0x11,
+    0x01, 0x11, 0x01, 0x11, 0x01, 0x11, 0x01, 0x11, 0x01, 0x11, 0x01, 0x11, 0x01, 0x11, 0x01, 0x11,
+    0x01, 0x11, 0x01, 0x11, 0x01, 0x11, 0x01, 0x11, 0x01, 0x11, 0x01, 0x11, 0x01, 0x11, 0x01, 0x11,
+    0x01, 0x11, 0x01, 0x11, 0x01, 0x11, 0x01, 0x11, 0x01, 0x11, 0x01, 0x11, 0x01, 0x11, 0x01, 0x11,
+    0x01, 0x11, 0x01, 0x11, 0x01, 0x11, 0x01, 0x11, 0x01, 0x11, 0x01, 0x11, 0x01, 0x11, 0x01, 0x11,
+    0x01, 0x11, 0x01, 0x11, 0x01, 0x11, 0x01, 0x11, 0x01, 0x11, 0x01, 0x11, 0x01, 0x11, 0x01, 0x11,
+    0x01, 0x11, 0x01, 0x11, 0x01, 0x11, 0x01, 0x11, 0x01, 0x11, 0x01, 0x11, 0x01, 0x11, 0x01, 0x11,
+    0x01, 0x11, 0x01, 0x11, 0x01, 0x11, 0x01, 0x11, 0x01, 0x11, 0x01, 0x11, 0x01, 0x11, 0x01, 0x11,
+    0x01, 0x11, 0x01, 0x11, 0x01, 0x11,
+};
+
+static const uint16_t height3_palette[6] = {0x0000, 0xFFFF, 0x7BEF, 0xF7DE, 0xE7FF, 0xAD55};
+
+static const uint8_t height3_data[1428] = {
+    0x01, 0x1C, 0x2F, 0x44, 0x19, 0x2F, 0x56, 0x19, 0x2F, 0x44, 0x1C, 0x03, 0x1C, 0x2F, 0x44, 0x19,
+    0x2F, 0x56, 0x19, 0x2F, 0x44, 0x1C, 0x03, 0x1C, 0x21, 0x3F, 0x40, 0x21, 0x19, 0x21, 0x4F, 0x52,
+    0x21, 0x19, 0x21, 0x3F, 0x40, 0x21, 0x1C, 0x03, 0x1C, 0x21, 0x3F, 0x40, 0x21, 0x19, 0x21, 0x4F,
+    0x52, 0x21, 0x19, 0x21, 0x3F, 0x40, 0x21, 0x1C, 0x03, 0x1D, 0x20, 0x30, 0x1F, 0x3E, 0x30, 0x20,
+    0x1B, 0x20, 0x40, 0x1F, 0x50, 0x40, 0x20, 0x1B, 0x20, 0x30, 0x1F, 0x3E, 0x30, 0x20, 0x1D, 0x03,
+    0x1D, 0x20, 0x30, 0x1F, 0x3E, 0x30, 0x20, 0x1B, 0x20, 0x40, 0x1F, 0x50, 0x40, 0x20, 0x1B, 0x20,
+    0x30, 0x1F, 0x3E, 0x30, 0x20, 0x1D, 0x03, 0x1E, 0x20, 0x3F, 0x3E, 0x20, 0x1D, 0x20, 0x4F, 0x50,
+    0x20, 0x1D, 0x20, 0x3F, 0x3E, 0x20, 0x1E, 0x03, 0x1F, 0x00, 0x20, 0x3F, 0x3C, 0x20, 0x1F, 0x00,
+    0x20, 0x4F, 0x4E, 0x20, 0x1F, 0x00, 0x20, 0x3F, 0x3C, 0x20, 0x1F, 0x00, 0x03, 0x1F, 0x01, 0x20,
+    0x3F, 0x3A, 0x20, 0x1F, 0x02, 0x20, 0x4F, 0x4C, 0x20, 0x1F, 0x02, 0x20, 0x3F, 0x3A, 0x20, 0x1F,
+    0x01, 0x03, 0x1F, 0x03, 0x20, 0x3F, 0x36, 0x20, 0x1F, 0x06, 0x20, 0x4F, 0x48, 0x20, 0x1F, 0x06,
+    0x20, 0x3F, 0x36, 0x20, 0x1F, 0x03, 0x03, 0x1B, 0x21, 0x3F, 0x42, 0x21, 0x17, 0x21, 0x4F, 0x54,
+    0x21, 0x17, 0x21, 0x3F, 0x42, 0x21, 0x1B, 0x03, 0x1B, 0x21, 0x3F, 0x42, 0x21, 0x17, 0x21, 0x4F,
+    0x54, 0x21, 0x17, 0x21, 0x3F, 0x42, 0x21, 0x1B, 0x03, 0x1B, 0x21, 0x3F, 0x42, 0x21, 0x17, 0x21,
+    0x4F, 0x54, 0x21, 0x17, 0x21, 0x3F, 0x42, 0x21, 0x1B, 0x03, 0x1B, 0x21, 0x3F, 0x42, 0x21, 0x17,
+    0x21, 0x4F, 0x54, 0x21, 0x17, 0x21, 0x3F, 0x42, 0x21, 0x1B, 0x03, 0x1B, 0x21, 0x3F, 0x42, 0x21,
+    0x17, 0x21, 0x4F, 0x54, 0x21, 0x17, 0x21, 0x3F, 0x42, 0x21, 0x1B, 0x03, 0x1B, 0x21, 0x3F, 0x42,
+    0x21, 0x17, 0x21, 0x4F, 0x54, 0x21, 0x17, 0x21, 0x3F, 0x42, 0x21, 0x1B, 0x03, 0x1B, 0x21, 0x3F,
+    0x42, 0x21, 0x17, 0x21, 0x4F, 0x54, 0x21, 0x17, 0x21, 0x3F, 0x42, 0x21, 0x1B, 0x03, 0x1B, 0x21,
+    0x3F, 0x42, 0x21, 0x17, 0x21, 0x4F, 0x54, 0x21, 0x17, 0x21, 0x3F, 0x42, 0x21, 0x1B, 0x03, 0x1B,
+    0x21, 0x3F, 0x42, 0x21, 0x17, 0x21, 0x4F, 0x54, 0x21, 0x17, 0x21, 0x3F, 0x42, 0x21, 0x1B, 0x03,
+    0x1B, 0x21, 0x3F, 0x42, 0x21, 0x17, 0x21, 0x4F, 0x54, 0x21, 0x17, 0x21, 0x3F, 0x42, 0x21, 0x1B,
+    0x03, 0x1B, 0x21, 0x3F, 0x42, 0x21, 0x17, 0x21, 0x4F, 0x54, 0x21, 0x17, 0x21, 0x3F, 0x42, 0x21,
+    0x1B, 0x03, 0x1B, 0x21, 0x3F, 0x42, 0x21, 0x17, 0x21, 0x4F, 0x54, 0x21, 0x17, 0x21, 0x3F, 0x42,
+    0x21, 0x1B, 0x03, 0x1B, 0x21, 0x3F, 0x42, 0x21, 0x17, 0x21, 0x4F, 0x54, 0x21, 0x17, 0x21, 0x3F,
+    0x42, 0x21, 0x1B, 0x03, 0x1B, 0x21, 0x3F, 0x42, 0x21, 0x17, 0x21, 0x4F, 0x54, 0x21, 0x17, 0x21,
+    0x3F, 0x42, 0x21, 0x1B, 0x03, 0x1B, 0x21, 0x3F, 0x42, 0x21, 0x17, 0x21, 0x4F, 0x54, 0x21, 0x17,
+    0x21, 0x3F, 0x42, 0x21, 0x1B, 0x03, 0x1B, 0x21, 0x3F, 0x42, 0x21, 0x17, 0x21, 0x4F, 0x54, 0x21,
+    0x17, 0x21, 0x3F, 0x42, 0x21, 0x1B, 0x03, 0x1B, 0x21, 0x3F, 0x42, 0x21, 0x17, 0x21, 0x4F, 0x17,
+    0x00, 0x4F, 0x09, 0x00, 0x4F, 0x12, 0x21, 0x17, 0x21, 0x3F, 0x42, 0x21, 0x1B, 0x03, 0x1B, 0x21,
+    0x3F, 0x19, 0x01, 0x3F, 0x17, 0x21, 0x17, 0x21, 0x4F, 0x0A, 0x0E, 0x4F, 0x05, 0x00, 0x41, 0x00,
+    0x4F, 0x12, 0x21, 0x17, 0x21, 0x3F, 0x15, 0x01, 0x3F, 0x1B, 0x21, 0x1B, 0x03, 0x1B, 0x21, 0x3F,
+    0x19, 0x01, 0x3F, 0x17, 0x21, 0x17, 0x21, 0x4F, 0x10, 0x00, 0x4F, 0x0D, 0x00, 0x41, 0x00, 0x42,
+    0x00, 0x4F, 0x0E, 0x21, 0x17, 0x21, 0x3F, 0x15, 0x01, 0x3F, 0x1B, 0x21, 0x1B, 0x03, 0x1B, 0x21,
+    0x3F, 0x17, 0x01, 0x3F, 0x19, 0x21, 0x17, 0x21, 0x4F, 0x10, 0x00, 0x4F, 0x0D, 0x00, 0x41, 0x05,
+    0x4F, 0x0D, 0x21, 0x17, 0x21, 0x3F, 0x17, 0x01, 0x3F, 0x19, 0x21, 0x1B, 0x03, 0x1B, 0x21, 0x3F,
+    0x17, 0x01, 0x3F, 0x19, 0x21, 0x17, 0x21, 0x4F, 0x10, 0x00, 0x4F, 0x0D, 0x00, 0x41, 0x00, 0x4F,
+    0x12, 0x21, 0x17, 0x21, 0x3F, 0x17, 0x01, 0x3F, 0x19, 0x21, 0x1B, 0x03, 0x1B, 0x21, 0x3F, 0x15,
+    0x01, 0x3F, 0x1B, 0x21, 0x17, 0x21, 0x4F, 0x10, 0x00, 0x40, 0x00, 0x4F, 0x0B, 0x00, 0x41, 0x00,
+    0x44, 0x00, 0x4F, 0x0C, 0x21, 0x17, 0x21, 0x3F, 0x19, 0x01, 0x3F, 0x17, 0x21, 0x1B, 0x03, 0x1B,
+    0x21, 0x3F, 0x15, 0x01, 0x3F, 0x1B, 0x21, 0x17, 0x21, 0x4F, 0x10, 0x00, 0x41, 0x00, 0x4F, 0x03,
+    0x00, 0x41, 0x0E, 0x4F, 0x0B, 0x21, 0x17, 0x21, 0x3F, 0x19, 0x01, 0x3F, 0x17, 0x21, 0x1B, 0x03,
+    0x1B, 0x21, 0x3F, 0x15, 0x01, 0x3F, 0x1B, 0x21, 0x17, 0x21, 0x4F, 0x10, 0x00, 0x42, 0x01, 0x43,
+    0x0E, 0x47, 0x00, 0x4F, 0x12, 0x21, 0x17, 0x21, 0x3F, 0x19, 0x01, 0x3F, 0x17, 0x21, 0x1B, 0x03,
+    0x1B, 0x21, 0x3F, 0x15, 0x01, 0x3F, 0x1B, 0x21, 0x17, 0x21, 0x4F, 0x10, 0x00, 0x43, 0x00, 0x4F,
+    0x08, 0x00, 0x41, 0x00, 0x42, 0x00, 0x4F, 0x0E, 0x21, 0x17, 0x21, 0x3F, 0x19, 0x01, 0x3F, 0x17,
+    0x21, 0x1B, 0x03, 0x1B, 0x21, 0x3F, 0x15, 0x01, 0x3F, 0x1B, 0x21, 0x17, 0x21, 0x4F, 0x10, 0x00,
+    0x4F, 0x0D, 0x01, 0x40, 0x00, 0x42, 0x01, 0x4F, 0x0D, 0x21, 0x17, 0x21, 0x3F, 0x19, 0x01, 0x3F,
+    0x17, 0x21, 0x1B, 0x03, 0x1B, 0x21, 0x3F, 0x15, 0x01, 0x3F, 0x1B, 0x21, 0x17, 0x21, 0x4F, 0x10,
+    0x00, 0x4F, 0x0C, 0x00, 0x42, 0x00, 0x41, 0x00, 0x4F, 0x0F, 0x21, 0x17, 0x21, 0x3F, 0x19, 0x01,
+    0x3F, 0x17, 0x21, 0x1B, 0x03, 0x1B, 0x21, 0x3F, 0x17, 0x01, 0x3F, 0x19, 0x21, 0x17, 0x21, 0x4F,
+    0x10, 0x00, 0x4F, 0x0B, 0x00, 0x43, 0x00, 0x41, 0x00, 0x4F, 0x0F, 0x21, 0x17, 0x21, 0x3F, 0x17,
+    0x01, 0x3F, 0x19, 0x21, 0x1B, 0x03, 0x1B, 0x21, 0x3F, 0x17, 0x01, 0x3F, 0x19, 0x21, 0x17, 0x21,
+    0x4F, 0x10, 0x00, 0x4F, 0x11, 0x01, 0x4F, 0x10, 0x21, 0x17, 0x21, 0x3F, 0x17, 0x01, 0x3F, 0x19,
+    0x21, 0x1B, 0x03, 0x1B, 0x21, 0x3F, 0x19, 0x01, 0x3F, 0x17, 0x21, 0x17, 0x21, 0x4F, 0x10, 0x00,
+    0x4F, 0x0F, 0x01, 0x4F, 0x12, 0x21, 0x17, 0x21, 0x3F, 0x15, 0x01, 0x3F, 0x1B, 0x21, 0x1B, 0x03,
+    0x1B, 0x21, 0x3F, 0x19, 0x01, 0x3F, 0x17, 0x21, 0x17, 0x21, 0x4F, 0x10, 0x00, 0x4F, 0x0D, 0x01,
+    0x4F, 0x14, 0x21, 0x17, 0x21, 0x3F, 0x15, 0x01, 0x3F, 0x1B, 0x21, 0x1B, 0x03, 0x1B, 0x21, 0x3F,
+    0x42, 0x21, 0x17, 0x21, 0x4F, 0x10, 0x00, 0x4F, 0x0A, 0x02, 0x4F, 0x16, 0x21, 0x17, 0x21, 0x3F,
+    0x42, 0x21, 0x1B, 0x03, 0x1B, 0x21, 0x3F, 0x42, 0x21, 0x17, 0x21, 0x4F, 0x54, 0x21, 0x17, 0x21,
+    0x3F, 0x42, 0x21, 0x1B, 0x03, 0x1B, 0x21, 0x3F, 0x42, 0x21, 0x17, 0x21, 0x4F, 0x54, 0x21, 0x17,
+    0x21, 0x3F, 0x42, 0x21, 0x1B, 0x03, 0x1B, 0x21, 0x3F, 0x42, 0x21, 0x17, 0x21, 0x4F, 0x54, 0x21,
+    0x17, 0x21, 0x3F, 0x42, 0x21, 0x1B, 0x03, 0x1B, 0x21, 0x3F, 0x42, 0x21, 0x17, 0x21, 0x4F, 0x54,
+    0x21, 0x17, 0x21, 0x3F, 0x42, 0x21, 0x1B, 0x03, 0x1B, 0x21, 0x3F, 0x42, 0x21, 0x17, 0x21, 0x4F,
+    0x54, 0x21, 0x17, 0x21, 0x3F, 0x42, 0x21, 0x1B, 0x03, 0x1B, 0x21, 0x3F, 0x42, 0x21, 0x17, 0x21,
+    0x4F, 0x54, 0x21, 0x17, 0x21, 0x3F, 0x42, 0x21, 0x1B, 0x03, 0x1B, 0x21, 0x3F, 0x42, 0x21, 0x17,
+    0x21, 0x4F, 0x54, 0x21, 0x17, 0x21, 0x3F, 0x42, 0x21, 0x1B, 0x03, 0x1B, 0x21, 0x3F, 0x42, 0x21,
+    0x17, 0x21, 0x4F, 0x54, 0x21, 0x17, 0x21, 0x3F, 0x42, 0x21, 0x1B, 0x03, 0x1B, 0x21, 0x3F, 0x42,
+    0x21, 0x17, 0x21, 0x4F, 0x54, 0x21, 0x17, 0x21, 0x3F, 0x42, 0x21, 0x1B, 0x03, 0x1B, 0x21, 0x3F,
+    0x42, 0x21, 0x17, 0x21, 0x4F, 0x54, 0x21, 0x17, 0x21, 0x3F, 0x42, 0x21, 0x1B, 0x03, 0x1B, 0x21,
+    0x3F, 0x42, 0x21, 0x17, 0x21, 0x4F, 0x54, 0x21, 0x17, 0x21, 0x3F, 0x42, 0x21, 0x1B, 0x03, 0x1B,
+    0x21, 0x3F, 0x42, 0x21, 0x17, 0x21, 0x4F, 0x54, 0x21, 0x17, 0x21, 0x3F, 0x42, 0x21, 0x1B, 0x03,
+    0x1B, 0x21, 0x3F, 0x42, 0x21, 0x17, 0x21, 0x4F, 0x54, 0x21, 0x17, 0x21, 0x3F, 0x42, 0x21, 0x1B,
+    0x03, 0x1B, 0x21, 0x3F, 0x42, 0x21, 0x17, 0x21, 0x4F, 0x54, 0x21, 0x17, 0x21, 0x3F, 0x42, 0x21,
+    0x1B, 0x03, 0x1B, 0x21, 0x3F, 0x42, 0x21, 0x17, 0x21, 0x4F, 0x54, 0x21, 0x17, 0x21, 0x3F, 0x42,
+    0x21, 0x1B, 0x03, 0x1B, 0x21, 0x3F, 0x42, 0x21, 0x17, 0x21, 0x4F, 0x54, 0x21, 0x17, 0x21, 0x3F,
+    0x42, 0x21, 0x1B, 0x03, 0x1F, 0x03, 0x20, 0x3F, 0x36, 0x20, 0x1F, 0x06, 0x20, 0x4F, 0x48, 0x20,
+    0x1F, 0x06, 0x20, 0x3F, 0x36, 0x20, 0x1F, 0x03, 0x03, 0x1F, 0x01, 0x20, 0x3F, 0x3A, 0x20, 0x1F,
+    0x02, 0x20, 0x4F, 0x4C, 0x20, 0x1F, 0x02, 0x20, 0x3F, 0x3A, 0x20, 0x1F, 0x01, 0x03, 0x1F, 0x00,
+    0x20, 0x3F, 0x3C, 0x20, 0x1F, 0x00, 0x20, 0x4F, 0x4E, 0x20, 0x1F, 0x00, 0x20, 0x3F, 0x3C, 0x20,
+    0x1F, 0x00, 0x03, 0x1E, 0x20, 0x3F, 0x3E, 0x20, 0x1D, 0x20, 0x4F, 0x50, 0x20, 0x1D, 0x20, 0x3F,
+    0x3E, 0x20, 0x1E, 0x03, 0x1D, 0x20, 0x30, 0x5F, 0x3E, 0x30, 0x20, 0x1B, 0x20, 0x40, 0x5F, 0x50,
+    0x40, 0x20, 0x1B, 0x20, 0x30, 0x5F, 0x3E, 0x30, 0x20, 0x1D, 0x03, 0x1D, 0x20, 0x30, 0x5F, 0x3E,
+    0x30, 0x20, 0x1B, 0x20, 0x40, 0x5F, 0x50, 0x40, 0x20, 0x1B, 0x20, 0x30, 0x5F, 0x3E, 0x30, 0x20,
+    0x1D, 0x03, 0x1C, 0x21, 0x3F, 0x40, 0x21, 0x19, 0x21, 0x4F, 0x52, 0x21, 0x19, 0x21, 0x3F, 0x40,
+    0x21, 0x1C, 0x03, 0x1C, 0x21, 0x3F, 0x40, 0x21, 0x19, 0x21, 0x4F, 0x52, 0x21, 0x19, 0x21, 0x3F,
+    0x40, 0x21, 0x1C, 0x03, 0x1C, 0x2F, 0x44, 0x19, 0x2F, 0x56, 0x19, 0x2F, 0x44, 0x1C, 0x03, 0x1C,
+    0x2F, 0x44, 0x19, 0x2F, 0x56, 0x19, 0x2F, 0x44, 0x1C, 0x03, 0x1F, 0xAC, 0x02, 0x03, 0x1F, 0xAC,
+    0x02, 0x03, 0x1F, 0xAC, 0x02, 0x03, 0x1F, 0xAC, 0x02, 0x03, 0x1F, 0xAC, 0x02, 0x03, 0x1F, 0xAC,
+    0x02, 0x0F, 0xF2, 0x04,
+};
+
+static const RleImage height_pieces[4] = {
+    {0, 0, 320, 41, 3, height0_palette, height0_data, 627},
+    {0, 41, 4, 123, 2, height1_palette, height1_data, 246},
+    {316, 41, 4, 123, 2, height2_palette, height2_data, 246},
+    {0, 164, 320, 76, 6, height3_palette, height3_data, 1428},
+};
+
+static const uint16_t weigh0_palette[7] = {0x0000, 0xFFFF, 0xC618, 0x7BEF, 0xE7FF, 0xF7DE, 0xAD55};
+
+static const uint8_t weigh0_data[1815] = {
+    0x0F, 0xF2, 0x04, 0x1F, 0xAC, 0x02, 0x03, 0x1F, 0xAC, 0x02, 0x03, 0x1F, 0xAC, 0x02, 0x03, 0x1F,
+    0xAC, 0x02, 0x03, 0x1F, 0x3E, 0x20, 0x1F, 0xDD, 0x01, 0x03, 0x1F, 0x3E, 0x20, 0x1F, 0xDD, 0x01,
+    0x03, 0x1F, 0x3E, 0x20, 0x1F, 0xDD, 0x01, 0x03, 0x1F, 0x3E, 0x20, 0x1F, 0xDD, 0x01, 0x03, 0x1F,
+    0x3E, 0x20, 0x1F, 0xDD, 0x01, 0x03, 0x1F, 0x3E, 0x20, 0x1F, 0xDD, 0x01, 0x03, 0x1F, 0x3E, 0x20,
+    0x1F, 0xDD, 0x01, 0x03, 0x1F, 0x3E, 0x20, 0x1F, 0xDD, 0x01, 0x03, 0x1F, 0x3E, 0x20, 0x1F, 0xDD,
+    0x01, 0x03, 0x1F, 0x3E, 0x20, 0x1F, 0xDD, 0x01, 0x03, 0x1F, 0x3E, 0x20, 0x1F, 0xDD, 0x01, 0x03,
+    0x1F, 0x3E, 0x20, 0x1F, 0xDD, 0x01, 0x03, 0x1F, 0x3E, 0x20, 0x1F, 0xDD, 0x01, 0x03, 0x1F, 0x3E,
+    0x20, 0x1F, 0xDD, 0x01, 0x03, 0x1F, 0x3E, 0x20, 0x1F, 0xDD, 0x01, 0x03, 0x1F, 0x3E, 0x20, 0x1F,
+    0xDD, 0x01, 0x03, 0x1F, 0x3E, 0x20, 0x1F, 0xDD, 0x01, 0x03, 0x1F, 0x3E, 0x20, 0x1F, 0xDD, 0x01,
+    0x03, 0x1F, 0x3E, 0x20, 0x1F, 0xDD, 0x01, 0x03, 0x1F, 0x3E, 0x20, 0x1F, 0xDD, 0x01, 0x03, 0x1F,
+    0x3E, 0x20, 0x1F, 0xDD, 0x01, 0x03, 0x1F, 0x3E, 0x20, 0x1F, 0xDD, 0x01, 0x03, 0x1F, 0x3E, 0x20,
+    0x1F, 0xDD, 0x01, 0x03, 0x1F, 0x3E, 0x20, 0x1F, 0xDD, 0x01, 0x03, 0x1F, 0x3E, 0x20, 0x1F, 0xDD,
+    0x01, 0x03, 0x1F, 0x3E, 0x20, 0x1F, 0xDD, 0x01, 0x03, 0x1F, 0x3E, 0x20, 0x1F, 0xDD, 0x01, 0x03,
+    0x1F, 0x3E, 0x20, 0x1F, 0xDD, 0x01, 0x03, 0x1F, 0x3E, 0x20, 0x1F, 0xDD, 0x01, 0x03, 0x1F, 0x3E,
+    0x20, 0x1F, 0xDD, 0x01, 0x03, 0x1F, 0x3E, 0x20, 0x1F, 0xDD, 0x01, 0x03, 0x1F, 0x3E, 0x20, 0x1F,
+    0xDD, 0x01, 0x03, 0x1F, 0x3E, 0x20, 0x1F, 0xDD, 0x01, 0x03, 0x1F, 0x3E, 0x20, 0x1F, 0xDD, 0x01,
+    0x03, 0x1F, 0x3E, 0x20, 0x1F, 0xDD, 0x01, 0x03, 0x1F, 0x3E, 0x20, 0x1F, 0xDD, 0x01, 0x03, 0x1F,
+    0x3E, 0x20, 0x1F, 0xDD, 0x01, 0x03, 0x1F, 0x3E, 0x20, 0x1F, 0xDD, 0x01, 0x03, 0x1F, 0x3E, 0x20,
+    0x1F, 0xDD, 0x01, 0x03, 0x1F, 0x3E, 0x20, 0x1F, 0xDD, 0x01, 0x03, 0x1F, 0x3E, 0x20, 0x1F, 0xDD,
+    0x01, 0x03, 0x1F, 0x3E, 0x20, 0x1F, 0xDD, 0x01, 0x03, 0x1F, 0x3E, 0x20, 0x1F, 0xDD, 0x01, 0x03,
+    0x1F, 0x3E, 0x20, 0x1F, 0xDD, 0x01, 0x03, 0x1F, 0x3E, 0x20, 0x1F, 0xDD, 0x01, 0x03, 0x1F, 0x3E,
+    0x20, 0x1F, 0xDD, 0x01, 0x03, 0x1F, 0x3E, 0x20, 0x1F, 0xDD, 0x01, 0x03, 0x1F, 0x3E, 0x20, 0x1F,
+    0xDD, 0x01, 0x03, 0x1F, 0x3E, 0x20, 0x1F, 0xDD, 0x01, 0x03, 0x1F, 0x3E, 0x20, 0x1F, 0xDD, 0x01,
+    0x03, 0x1F, 0x3E, 0x20, 0x1F, 0xDD, 0x01, 0x03, 0x1F, 0x3E, 0x20, 0x1F, 0xDD, 0x01, 0x03, 0x1F,
+    0x3E, 0x20, 0x1F, 0xDD, 0x01, 0x03, 0x1F, 0x3E, 0x20, 0x1F, 0xDD, 0x01, 0x03, 0x1F, 0xAC, 0x02,
+    0x03, 0x1F, 0xAC, 0x02, 0x03, 0x1F, 0xAC, 0x02, 0x03, 0x1F, 0xAC, 0x02, 0x03, 0x1F, 0xAC, 0x02,
+    0x03, 0x1F, 0xAC, 0x02, 0x01, 0x2F, 0xB0, 0x02, 0x01, 0x1F, 0xAC, 0x02, 0x03, 0x1F, 0xAC, 0x02,
+    0x03, 0x1F, 0xAC, 0x02, 0x03, 0x1F, 0xAC, 0x02, 0x03, 0x1F, 0xAC, 0x02, 0x03, 0x1F, 0xAC, 0x02,
+    0x03, 0x1F, 0xAC, 0x02, 0x03, 0x1F, 0xAC, 0x02, 0x03, 0x1F, 0xAC, 0x02, 0x03, 0x1F, 0xAC, 0x02,
+    0x03, 0x1F, 0xAC, 0x02, 0x03, 0x1F, 0xAC, 0x02, 0x03, 0x1F, 0xAC, 0x02, 0x03, 0x1F, 0xAC, 0x02,
+    0x03, 0x1F, 0xAC, 0x02, 0x03, 0x1F, 0xAC, 0x02, 0x03, 0x1F, 0xAC, 0x02, 0x03, 0x1F, 0xAC, 0x02,
+    0x03, 0x1F, 0xAC, 0x02, 0x03, 0x1F, 0xAC, 0x02, 0x03, 0x1F, 0xAC, 0x02, 0x03, 0x1F, 0xAC, 0x02,
+    0x03, 0x1F, 0xAC, 0x02, 0x03, 0x1F, 0xAC, 0x02, 0x03, 0x1F, 0xAC, 0x02, 0x03, 0x1F, 0xAC, 0x02,
+    0x03, 0x1F, 0xAC, 0x02, 0x03, 0x1F, 0xAC, 0x02, 0x03, 0x1F, 0xAC, 0x02, 0x03, 0x1F, 0xAC, 0x02,
+    0x03, 0x1F, 0xAC, 0x02, 0x03, 0x1F, 0xAC, 0x02, 0x03, 0x1F, 0xAC, 0x02, 0x03, 0x1F, 0xAC, 0x02,
+    0x03, 0x1F, 0xAC, 0x02, 0x03, 0x1F, 0xAC, 0x02, 0x03, 0x1F, 0xAC, 0x02, 0x03, 0x1F, 0xAC, 0x02,
+    0x03, 0x1F, 0xAC, 0x02, 0x03, 0x1F, 0xAC, 0x02, 0x03, 0x1F, 0xAC, 0x02, 0x03, 0x1F, 0xAC, 0x02,
+    0x03, 0x1F, 0xAC, 0x02, 0x03, 0x1F, 0xAC, 0x02, 0x03, 0x1F, 0xAC, 0x02, 0x03, 0x1F, 0xAC, 0x02,
+    0x03, 0x1F, 0xAC, 0x02, 0x03, 0x1F, 0xAC, 0x02, 0x03, 0x1F, 0xAC, 0x02, 0x03, 0x1F, 0xAC, 0x02,
+    0x03, 0x1F, 0xAC, 0x02, 0x03, 0x1F, 0xAC, 0x02, 0x03, 0x1F, 0xAC, 0x02, 0x03, 0x1F, 0xAC, 0x02,
+    0x03, 0x1F, 0xAC, 0x02, 0x03, 0x1F, 0xAC, 0x02, 0x03, 0x1F, 0xAC, 0x02, 0x03, 0x1F, 0xAC, 0x02,
+    0x03, 0x1F, 0xAC, 0x02, 0x03, 0x1F, 0xAC, 0x02, 0x03, 0x1F, 0xAC, 0x02, 0x03, 0x1F, 0xAC, 0x02,
+    0x03, 0x1F, 0xAC, 0x02, 0x03, 0x1F, 0xAC, 0x02, 0x03, 0x1F, 0xAC, 0x02, 0x03, 0x1F, 0xAC, 0x02,
+    0x03, 0x1F, 0xAC, 0x02, 0x03, 0x1F, 0xAC, 0x02, 0x03, 0x1F, 0xAC, 0x02, 0x03, 0x1F, 0xAC, 0x02,
+    0x03, 0x1F, 0xAC, 0x02, 0x03, 0x1F, 0xAC, 0x02, 0x03, 0x1F, 0xAC, 0x02, 0x03, 0x1F, 0xAC, 0x02,
+    0x03, 0x1F, 0xAC, 0x02, 0x03, 0x1F, 0xAC, 0x02, 0x03, 0x1F, 0xAC, 0x02, 0x03, 0x1F, 0xAC, 0x02,
+    0x03, 0x1F, 0xAC, 0x02, 0x03, 0x1F, 0xAC, 0x02, 0x03, 0x1F, 0xAC, 0x02, 0x03, 0x1F, 0xAC, 0x02,
+    0x03, 0x1F, 0xAC, 0x02, 0x03, 0x1F, 0xAC, 0x02, 0x03, 0x1F, 0xAC, 0x02, 0x03, 0x1F, 0xAC, 0x02,
+    0x03, 0x1F, 0xAC, 0x02, 0x03, 0x1F, 0xAC, 0x02, 0x03, 0x1F, 0xAC, 0x02, 0x03, 0x1F, 0xAC, 0x02,
+    0x03, 0x1F, 0xAC, 0x02, 0x03, 0x1F, 0xAC, 0x02, 0x03, 0x1F, 0xAC, 0x02, 0x03, 0x1F, 0xAC, 0x02,
+    0x03, 0x1F, 0xAC, 0x02, 0x03, 0x1F, 0xAC, 0x02, 0x03, 0x1F, 0xAC, 0x02, 0x03, 0x1F, 0xAC, 0x02,
+    0x03, 0x1F, 0xAC, 0x02, 0x03, 0x1F, 0xAC, 0x02, 0x03, 0x1F, 0xAC, 0x02, 0x03, 0x1F, 0xAC, 0x02,
+    0x03, 0x1F, 0xAC, 0x02, 0x03, 0x1F, 0xAC, 0x02, 0x03, 0x1F, 0xAC, 0x02, 0x03, 0x1F, 0xAC, 0x02,
+    0x03, 0x1F, 0xAC, 0x02, 0x03, 0x1F, 0xAC, 0x02, 0x03, 0x1F, 0xAC, 0x02, 0x03, 0x1F, 0xAC, 0x02,
+    0x03, 0x1F, 0xAC, 0x02, 0x03, 0x1F, 0xAC, 0x02, 0x03, 0x1F, 0xAC, 0x02, 0x03, 0x1F, 0xAC, 0x02,
+    0x03, 0x1F, 0xAC, 0x02, 0x03, 0x1F, 0xAC, 0x02, 0x03, 0x1F, 0xAC, 0x02, 0x03, 0x1F, 0xAC, 0x02,
+    0x03, 0x1F, 0xAC, 0x02, 0x03, 0x1F, 0xAC, 0x02, 0x03, 0x1F, 0xAC, 0x02, 0x03, 0x1F, 0xAC, 0x02,
+    0x03, 0x1F, 0xAC, 0x02, 0x03, 0x1F, 0xAC, 0x02, 0x03, 0x1F, 0xAC, 0x02, 0x03, 0x18, 0x3F, 0x66,
+    0x1F, 0x2E, 0x3F, 0x66, 0x18, 0x03, 0x18, 0x3F, 0x66, 0x1F, 0x2E, 0x3F, 0x66, 0x18, 0x03, 0x18,
+    0x31, 0x4F, 0x62, 0x31, 0x1F, 0x2E, 0x31, 0x5F, 0x62, 0x31, 0x18, 0x03, 0x18, 0x31, 0x4F, 0x62,
+    0x31, 0x1F, 0x2E, 0x31, 0x5F, 0x62, 0x31, 0x18, 0x03, 0x19, 0x30, 0x40, 0x1F, 0x60, 0x40, 0x30,
+    0x1F, 0x30, 0x30, 0x50, 0x1F, 0x60, 0x50, 0x30, 0x19, 0x03, 0x19, 0x30, 0x40, 0x1F, 0x60, 0x40,
+    0x30, 0x1F, 0x30, 0x30, 0x50, 0x1F, 0x60, 0x50, 0x30, 0x19, 0x03, 0x1A, 0x30, 0x4F, 0x60, 0x30,
+    0x1F, 0x32, 0x30, 0x5F, 0x60, 0x30, 0x1A, 0x03, 0x1B, 0x30, 0x4F, 0x5E, 0x30, 0x1F, 0x34, 0x30,
+    0x5F, 0x5E, 0x30, 0x1B, 0x03, 0x1C, 0x30, 0x4F, 0x5C, 0x30, 0x1F, 0x36, 0x30, 0x5F, 0x5C, 0x30,
+    0x1C, 0x03, 0x1E, 0x30, 0x4F, 0x58, 0x30, 0x1F, 0x3A, 0x30, 0x5F, 0x58, 0x30, 0x1E, 0x03, 0x17,
+    0x31, 0x4F, 0x64, 0x31, 0x1F, 0x2C, 0x31, 0x5F, 0x64, 0x31, 0x17, 0x03, 0x17, 0x31, 0x4F, 0x64,
+    0x31, 0x1F, 0x2C, 0x31, 0x5F, 0x64, 0x31, 0x17, 0x03, 0x17, 0x31, 0x4F, 0x64, 0x31, 0x1F, 0x2C,
+    0x31, 0x5F, 0x64, 0x31, 0x17, 0x03, 0x17, 0x31, 0x4F, 0x64, 0x31, 0x1F, 0x2C, 0x31, 0x5F, 0x64,
+    0x31, 0x17, 0x03, 0x17, 0x31, 0x4F, 0x21, 0x00, 0x4F, 0x00, 0x00, 0x4F, 0x21, 0x31, 0x1F, 0x2C,
+    0x31, 0x5F, 0x26, 0x00, 0x5F, 0x2D, 0x31, 0x17, 0x03, 0x17, 0x31, 0x4F, 0x21, 0x00, 0x4F, 0x00,
+    0x00, 0x4F, 0x21, 0x31, 0x1F, 0x2C, 0x31, 0x5F, 0x1B, 0x00, 0x58, 0x02, 0x5E, 0x00, 0x5F, 0x1C,
+    0x31, 0x17, 0x03, 0x17, 0x31, 0x4F, 0x21, 0x00, 0x43, 0x00, 0x4A, 0x00, 0x4F, 0x21, 0x31, 0x1F,
+    0x2C, 0x31, 0x5F, 0x1C, 0x01, 0x51, 0x04, 0x55, 0x0D, 0x5F, 0x1B, 0x31, 0x17, 0x03, 0x17, 0x31,
+    0x4F, 0x1B, 0x0C, 0x43, 0x0B, 0x4F, 0x1C, 0x31, 0x1F, 0x2C, 0x31, 0x5F, 0x1D, 0x00, 0x51, 0x00,
+    0x59, 0x00, 0x5A, 0x00, 0x5F, 0x1C, 0x31, 0x17, 0x03, 0x17, 0x31, 0x4F, 0x21, 0x00, 0x49, 0x00,
+    0x44, 0x00, 0x43, 0x00, 0x4F, 0x1C, 0x31, 0x1F, 0x2C, 0x31, 0x5F, 0x20, 0x00, 0x59, 0x00, 0x56,
+    0x00, 0x52, 0x00, 0x5F, 0x1C, 0x31, 0x17, 0x03, 0x17, 0x31, 0x4F, 0x21, 0x00, 0x49, 0x00, 0x44,
+    0x00, 0x42, 0x00, 0x4F, 0x1D, 0x31, 0x1F, 0x2C, 0x31, 0x5F, 0x20, 0x00, 0x50, 0x04, 0x53, 0x00,
+    0x52, 0x05, 0x51, 0x00, 0x5F, 0x1C, 0x31, 0x17, 0x03, 0x17, 0x31, 0x4F, 0x21, 0x00, 0x49, 0x00,
+    0x44, 0x00, 0x4F, 0x21, 0x31, 0x1F, 0x2C, 0x31, 0x5F, 0x1A, 0x03, 0x51, 0x00, 0x54, 0x00, 0x53,
+    0x00, 0x52, 0x00, 0x52, 0x00, 0x52, 0x00, 0x5F, 0x1C, 0x31, 0x17, 0x03, 0x17, 0x31, 0x4F, 0x21,
+    0x00, 0x44, 0x00, 0x43, 0x00, 0x40, 0x08, 0x4F, 0x1D, 0x31, 0x1F, 0x2C, 0x31, 0x5F, 0x1D, 0x00,
+    0x51, 0x00, 0x50, 0x00, 0x51, 0x00, 0x54, 0x00, 0x52, 0x00, 0x52, 0x00, 0x52, 0x00, 0x5F, 0x1C,
+    0x31, 0x17, 0x03, 0x17, 0x31, 0x4F, 0x1A, 0x0E, 0x42, 0x00, 0x48, 0x00, 0x4F, 0x1D, 0x31, 0x1F,
+    0x2C, 0x31, 0x5F, 0x1D, 0x00, 0x51, 0x00, 0x51, 0x00, 0x50, 0x00, 0x54, 0x00, 0x52, 0x00, 0x52,
+    0x00, 0x52, 0x00, 0x5F, 0x1C, 0x31, 0x17, 0x03, 0x17, 0x31, 0x4F, 0x20, 0x00, 0x4A, 0x00, 0x41,
+    0x00, 0x44, 0x00, 0x4F, 0x1E, 0x31, 0x1F, 0x2C, 0x31, 0x5F, 0x1D, 0x00, 0x51, 0x00, 0x52, 0x00,
+    0x55, 0x00, 0x52, 0x00, 0x52, 0x00, 0x52, 0x00, 0x5F, 0x1C, 0x31, 0x17, 0x03, 0x17, 0x31, 0x4F,
+    0x20, 0x00, 0x4A, 0x00, 0x42, 0x00, 0x42, 0x00, 0x4F, 0x1F, 0x31, 0x1F, 0x2C, 0x31, 0x5F, 0x1D,
+    0x00, 0x51, 0x00, 0x51, 0x00, 0x50, 0x00, 0x54, 0x00, 0x52, 0x04, 0x52, 0x00, 0x5F, 0x1C, 0x31,
+    0x17, 0x03, 0x17, 0x31, 0x4F, 0x1F, 0x00, 0x42, 0x00, 0x47, 0x00, 0x43, 0x00, 0x40, 0x00, 0x4F,
+    0x20, 0x31, 0x1F, 0x2C, 0x31, 0x5F, 0x1D, 0x00, 0x50, 0x00, 0x51, 0x00, 0x52, 0x01, 0x52, 0x00,
+    0x52, 0x00, 0x52, 0x00, 0x52, 0x00, 0x5F, 0x1C, 0x31, 0x17, 0x03, 0x17, 0x31, 0x4F, 0x1E, 0x00,
+    0x44, 0x00, 0x46, 0x00, 0x44, 0x00, 0x4F, 0x21, 0x31, 0x1F, 0x2C, 0x31, 0x5F, 0x1D, 0x00, 0x50,
+    0x00, 0x50, 0x00, 0x54, 0x00, 0x52, 0x00, 0x5A, 0x00, 0x5F, 0x1C, 0x31, 0x17, 0x03, 0x17, 0x31,
+    0x4F, 0x1D, 0x00, 0x46, 0x00, 0x44, 0x00, 0x44, 0x00, 0x40, 0x01, 0x4F, 0x1F, 0x31, 0x1F, 0x2C,
+    0x31, 0x5F, 0x1C, 0x00, 0x50, 0x00, 0x5B, 0x0C, 0x5F, 0x1C, 0x31, 0x17, 0x03, 0x17, 0x31, 0x4F,
+    0x1C, 0x0A, 0x43, 0x00, 0x42, 0x01, 0x43, 0x03, 0x4F, 0x1B, 0x31, 0x1F, 0x2C, 0x31, 0x5F, 0x1B,
+    0x00, 0x52, 0x00, 0x56, 0x01, 0x51, 0x00, 0x5A, 0x00, 0x5F, 0x1C, 0x31, 0x17, 0x03, 0x17, 0x31,
+    0x4F, 0x26, 0x00, 0x42, 0x00, 0x41, 0x01, 0x47, 0x00, 0x4F, 0x1C, 0x31, 0x1F, 0x2C, 0x31, 0x5F,
+    0x20, 0x07, 0x5F, 0x2C, 0x31, 0x17, 0x03, 0x17, 0x31, 0x4F, 0x64, 0x31, 0x1F, 0x2C, 0x31, 0x5F,
+    0x64, 0x31, 0x17, 0x03, 0x17, 0x31, 0x4F, 0x64, 0x31, 0x1F, 0x2C, 0x31, 0x5F, 0x64, 0x31, 0x17,
+    0x03, 0x17, 0x31, 0x4F, 0x64, 0x31, 0x1F, 0x2C, 0x31, 0x5F, 0x64, 0x31, 0x17, 0x03, 0x17, 0x31,
+    0x4F, 0x64, 0x31, 0x1F, 0x2C, 0x31, 0x5F, 0x64, 0x31, 0x17, 0x03, 0x1E, 0x30, 0x4F, 0x58, 0x30,
+    0x1F, 0x3A, 0x30, 0x5F, 0x58, 0x30, 0x1E, 0x03, 0x1C, 0x30, 0x4F, 0x5C, 0x30, 0x1F, 0x36, 0x30,
+    0x5F, 0x5C, 0x30, 0x1C, 0x03, 0x1B, 0x30, 0x4F, 0x5E, 0x30, 0x1F, 0x34, 0x30, 0x5F, 0x5E, 0x30,
+    0x1B, 0x03, 0x1A, 0x30, 0x4F, 0x60, 0x30, 0x1F, 0x32, 0x30, 0x5F, 0x60, 0x30, 0x1A, 0x03, 0x19,
+    0x30, 0x40, 0x6F, 0x60, 0x40, 0x30, 0x1F, 0x30, 0x30, 0x50, 0x6F, 0x60, 0x50, 0x30, 0x19, 0x03,
+    0x19, 0x30, 0x40, 0x6F, 0x60, 0x40, 0x30, 0x1F, 0x30, 0x30, 0x50, 0x6F, 0x60, 0x50, 0x30, 0x19,
+    0x03, 0x18, 0x31, 0x4F, 0x62, 0x31, 0x1F, 0x2E, 0x31, 0x5F, 0x62, 0x31, 0x18, 0x03, 0x18, 0x31,
+    0x4F, 0x62, 0x31, 0x1F, 0x2E, 0x31, 0x5F, 0x62, 0x31, 0x18, 0x03, 0x18, 0x3F, 0x66, 0x1F, 0x2E,
+    0x3F, 0x66, 0x18, 0x03, 0x18, 0x3F, 0x66, 0x1F, 0x2E, 0x3F, 0x66, 0x18, 0x03, 0x1F, 0xAC, 0x02,
+    0x03, 0x1F, 0xAC, 0x02, 0x0F, 0xF2, 0x04,
+};
+
+static const RleImage weigh_pieces[1] = {
+    {0, 0, 320, 240, 7, weigh0_palette, weigh0_data, 1815},
+};
+
+static const uint16_t pay0_palette[6] = {0x0000, 0xFFFF, 0xC618, 0x7BEF, 0xF7DE, 0xAD55};
+
+static const uint8_t pay0_data[1931] = {
+    0x0F, 0xF2, 0x04, 0x1F, 0xAC, 0x02, 0x03, 0x1F, 0xAC, 0x02, 0x03, 0x1F, 0xAC, 0x02, 0x03, 0x1F,
+    0xAC, 0x02, 0x03, 0x1F, 0x3E, 0x20, 0x1F, 0xDD, 0x01, 0x03, 0x1F, 0x3E, 0x20, 0x1F, 0xDD, 0x01,
+    0x03, 0x1E, 0x01, 0x1F, 0x11, 0x0B, 0x1F, 0x00, 0x01, 0x1F, 0x05, 0x01, 0x1B, 0x01, 0x1F, 0xB7,
+    0x01, 0x03, 0x1E, 0x01, 0x1F, 0x06, 0x0F, 0x07, 0x1F, 0x00, 0x01, 0x1F, 0x05, 0x01, 0x1A, 0x02,
+    0x1F, 0xB7, 0x01, 0x03, 0x1E, 0x01, 0x13, 0x0D, 0x13, 0x09, 0x10, 0x0B, 0x1F, 0x00, 0x01, 0x1F,
+    0x04, 0x02, 0x1A, 0x02, 0x1F, 0xB7, 0x01, 0x03, 0x1E, 0x01, 0x13, 0x0D, 0x16, 0x01, 0x1E, 0x02,
+    0x1F, 0x00, 0x01, 0x1F, 0x04, 0x02, 0x1A, 0x02, 0x1F, 0xB7, 0x01, 0x03, 0x1E, 0x01, 0x14, 0x0C,
+    0x16, 0x01, 0x16, 0x02, 0x14, 0x01, 0x15, 0x0F, 0x08, 0x17, 0x02, 0x1B, 0x02, 0x1F, 0xB7, 0x01,
+    0x03, 0x1A, 0x08, 0x1C, 0x01, 0x16, 0x01, 0x16, 0x02, 0x14, 0x01, 0x15, 0x0F, 0x08, 0x17, 0x02,
+    0x1B, 0x02, 0x1F, 0xB7, 0x01, 0x03, 0x1A, 0x08, 0x1C, 0x01, 0x15, 0x02, 0x16, 0x01, 0x15, 0x01,
+    0x1F, 0x01, 0x01, 0x1F, 0x02, 0x02, 0x12, 0x0F, 0x01, 0x1F, 0xB3, 0x01, 0x03, 0x1E, 0x01, 0x1F,
+    0x00, 0x01, 0x15, 0x01, 0x17, 0x01, 0x15, 0x01, 0x1F, 0x01, 0x01, 0x1F, 0x02, 0x02, 0x12, 0x0F,
+    0x01, 0x1F, 0xB3, 0x01, 0x03, 0x1E, 0x01, 0x1F, 0x00, 0x01, 0x15, 0x01, 0x17, 0x01, 0x14, 0x02,
+    0x1F, 0x01, 0x01, 0x1F, 0x01, 0x03, 0x1C, 0x02, 0x1F, 0xB7, 0x01, 0x03, 0x1E, 0x01, 0x1F, 0x00,
+    0x01, 0x14, 0x07, 0x11, 0x02, 0x14, 0x02, 0x1F, 0x01, 0x01, 0x1F, 0x00, 0x04, 0x1C, 0x02, 0x1F,
+    0xB7, 0x01, 0x03, 0x1E, 0x01, 0x1F, 0x00, 0x01, 0x14, 0x07, 0x11, 0x02, 0x14, 0x02, 0x17, 0x0F,
+    0x03, 0x17, 0x04, 0x1C, 0x02, 0x1F, 0xB7, 0x01, 0x03, 0x1E, 0x01, 0x1F, 0x00, 0x01, 0x13, 0x03,
+    0x12, 0x01, 0x11, 0x0C, 0x15, 0x0F, 0x03, 0x16, 0x02, 0x10, 0x01, 0x14, 0x00, 0x16, 0x02, 0x1F,
+    0xB7, 0x01, 0x03, 0x1E, 0x01, 0x10, 0x02, 0x10, 0x0C, 0x13, 0x03, 0x12, 0x01, 0x11, 0x0C, 0x17,
+    0x02, 0x1A, 0x01, 0x17, 0x01, 0x11, 0x01, 0x13, 0x02, 0x15, 0x02, 0x1F, 0xB7, 0x01, 0x03, 0x1E,
+    0x05, 0x10, 0x0C, 0x12, 0x04, 0x12, 0x01, 0x1C, 0x01, 0x18, 0x01, 0x19, 0x02, 0x17, 0x00, 0x12,
+    0x01, 0x14, 0x02, 0x14, 0x02, 0x1F, 0xB7, 0x01, 0x03, 0x1B, 0x06, 0x1D, 0x01, 0x12, 0x01, 0x10,
+    0x01, 0x12, 0x01, 0x1C, 0x01, 0x18, 0x02, 0x17, 0x02, 0x1C, 0x01, 0x14, 0x02, 0x14, 0x02, 0x1F,
+    0xB7, 0x01, 0x03, 0x1A, 0x05, 0x1F, 0x00, 0x01, 0x15, 0x01, 0x12, 0x01, 0x1C, 0x01, 0x19, 0x02,
+    0x15, 0x02, 0x1D, 0x01, 0x15, 0x02, 0x13, 0x02, 0x1F, 0xB7, 0x01, 0x03, 0x1A, 0x01, 0x11, 0x01,
+    0x1F, 0x00, 0x01, 0x15, 0x01, 0x12, 0x01, 0x1C, 0x01, 0x1A, 0x02, 0x13, 0x03, 0x1D, 0x01, 0x16,
+    0x02, 0x12, 0x02, 0x1F, 0xB7, 0x01, 0x03, 0x1E, 0x01, 0x1F, 0x00, 0x01, 0x15, 0x01, 0x12, 0x01,
+    0x10, 0x0A, 0x10, 0x01, 0x1A, 0x03, 0x11, 0x03, 0x1E, 0x01, 0x16, 0x02, 0x12, 0x02, 0x1F, 0xB7,
+    0x01, 0x03, 0x1E, 0x01, 0x1F, 0x00, 0x01, 0x15, 0x01, 0x12, 0x01, 0x10, 0x0A, 0x10, 0x01, 0x1B,
+    0x07, 0x1F, 0x00, 0x01, 0x17, 0x01, 0x12, 0x02, 0x1F, 0xB7, 0x01, 0x03, 0x1E, 0x01, 0x1F, 0x00,
+    0x01, 0x15, 0x01, 0x12, 0x01, 0x1C, 0x01, 0x1D, 0x04, 0x1F, 0x01, 0x01, 0x1C, 0x02, 0x1F, 0xB7,
+    0x01, 0x03, 0x1E, 0x01, 0x1F, 0x00, 0x01, 0x15, 0x06, 0x1C, 0x01, 0x1C, 0x05, 0x1F, 0x01, 0x01,
+    0x1C, 0x02, 0x1F, 0xB7, 0x01, 0x03, 0x1E, 0x01, 0x12, 0x0E, 0x15, 0x06, 0x1B, 0x02, 0x1A, 0x0A,
+    0x1D, 0x01, 0x1C, 0x02, 0x1F, 0xB7, 0x01, 0x03, 0x1E, 0x01, 0x12, 0x0E, 0x15, 0x01, 0x12, 0x01,
+    0x1A, 0x03, 0x17, 0x05, 0x13, 0x05, 0x1B, 0x01, 0x1C, 0x02, 0x1F, 0xB7, 0x01, 0x03, 0x1B, 0x00,
+    0x11, 0x01, 0x13, 0x0D, 0x15, 0x01, 0x12, 0x01, 0x15, 0x07, 0x15, 0x06, 0x17, 0x07, 0x17, 0x01,
+    0x1C, 0x02, 0x1F, 0xB7, 0x01, 0x03, 0x1B, 0x04, 0x1F, 0x00, 0x01, 0x1F, 0x03, 0x06, 0x14, 0x05,
+    0x1D, 0x05, 0x16, 0x01, 0x17, 0x07, 0x1F, 0xB7, 0x01, 0x03, 0x1B, 0x04, 0x1F, 0x22, 0x02, 0x1F,
+    0x03, 0x01, 0x17, 0x01, 0x18, 0x05, 0x1F, 0xB8, 0x01, 0x03, 0x1F, 0x3E, 0x20, 0x1F, 0xDD, 0x01,
+    0x03, 0x1F, 0x3E, 0x20, 0x1F, 0xDD, 0x01, 0x03, 0x1F, 0x3E, 0x20, 0x1F, 0xDD, 0x01, 0x03, 0x1F,
+    0x3E, 0x20, 0x1F, 0xDD, 0x01, 0x03, 0x1F, 0x3E, 0x20, 0x1F, 0xDD, 0x01, 0x03, 0x1F, 0x3E, 0x20,
+    0x1F, 0xDD, 0x01, 0x03, 0x1F, 0x3E, 0x20, 0x1F, 0xDD, 0x01, 0x03, 0x1F, 0x3E, 0x20, 0x1F, 0xDD,
+    0x01, 0x03, 0x1F, 0x3E, 0x20, 0x1F, 0xDD, 0x01, 0x03, 0x1F, 0x3E, 0x20, 0x1F, 0xDD, 0x01, 0x03,
+    0x1F, 0x3E, 0x20, 0x1F, 0xDD, 0x01, 0x03, 0x1F, 0x3E, 0x20, 0x1F, 0xDD, 0x01, 0x03, 0x1F, 0x3E,
+    0x20, 0x1F, 0xDD, 0x01, 0x03, 0x1F, 0x3E, 0x20, 0x1F, 0xDD, 0x01, 0x03, 0x1F, 0x3E, 0x20, 0x1F,
+    0xDD, 0x01, 0x03, 0x1F, 0x3E, 0x20, 0x1F, 0xDD, 0x01, 0x03, 0x1F, 0x3E, 0x20, 0x1F, 0xDD, 0x01,
+    0x03, 0x1F, 0x3E, 0x20, 0x1F, 0xDD, 0x01, 0x03, 0x1F, 0x3E, 0x20, 0x1F, 0xDD, 0x01, 0x03, 0x1F,
+    0x3E, 0x20, 0x1F, 0xDD, 0x01, 0x03, 0x1F, 0x3E, 0x20, 0x1F, 0xDD, 0x01, 0x03, 0x1F, 0x3E, 0x20,
+    0x1F, 0xDD, 0x01, 0x03, 0x1F, 0x3E, 0x20, 0x1F, 0xDD, 0x01, 0x03, 0x1F, 0x3E, 0x20, 0x1F, 0xDD,
+    0x01, 0x03, 0x1F, 0x3E, 0x20, 0x1F, 0xDD, 0x01, 0x03, 0x1F, 0x3E, 0x20, 0x1F, 0xDD, 0x01, 0x03,
+    0x1F, 0xAC, 0x02, 0x03, 0x1F, 0xAC, 0x02, 0x03, 0x1F, 0xAC, 0x02, 0x03, 0x1F, 0xAC, 0x02, 0x03,
+    0x1F, 0xAC, 0x02, 0x03, 0x1F, 0xAC, 0x02, 0x01, 0x2F, 0xB0, 0x02, 0x01, 0x1F, 0xAC, 0x02, 0x03,
+    0x1F, 0xAC, 0x02, 0x03, 0x1F, 0xAC, 0x02, 0x03, 0x1F, 0xAC, 0x02, 0x03, 0x1F, 0xAC, 0x02, 0x03,
+    0x1F, 0xAC, 0x02, 0x03, 0x1F, 0xAC, 0x02, 0x03, 0x1F, 0xAC, 0x02, 0x03, 0x1F, 0xAC, 0x02, 0x03,
+    0x1F, 0xAC, 0x02, 0x03, 0x1F, 0xAC, 0x02, 0x03, 0x1F, 0xAC, 0x02, 0x03, 0x1F, 0xAC, 0x02, 0x03,
+    0x1F, 0xAC, 0x02, 0x03, 0x1F, 0xAC, 0x02, 0x03, 0x1F, 0xAC, 0x02, 0x03, 0x1F, 0xAC, 0x02, 0x03,
+    0x1F, 0xAC, 0x02, 0x03, 0x1F, 0xAC, 0x02, 0x03, 0x1F, 0xAC, 0x02, 0x03, 0x1F, 0xAC, 0x02, 0x03,
+    0x1F, 0xAC, 0x02, 0x03, 0x1F, 0xAC, 0x02, 0x03, 0x1F, 0xAC, 0x02, 0x03, 0x1F, 0xAC, 0x02, 0x03,
+    0x1F, 0xAC, 0x02, 0x03, 0x1F, 0xAC, 0x02, 0x03, 0x1F, 0xAC, 0x02, 0x03, 0x1F, 0xAC, 0x02, 0x03,
+    0x1F, 0xAC, 0x02, 0x03, 0x1F, 0xAC, 0x02, 0x03, 0x1F, 0xAC, 0x02, 0x03, 0x1F, 0xAC, 0x02, 0x03,
+    0x1F, 0xAC, 0x02, 0x03, 0x1F, 0xAC, 0x02, 0x03, 0x1F, 0xAC, 0x02, 0x03, 0x1F, 0xAC, 0x02, 0x03,
+    0x1F, 0xAC, 0x02, 0x03, 0x1F, 0xAC, 0x02, 0x03, 0x1F, 0xAC, 0x02, 0x03, 0x1F, 0xAC, 0x02, 0x03,
+    0x1F, 0xAC, 0x02, 0x03, 0x1F, 0xAC, 0x02, 0x03, 0x1F, 0xAC, 0x02, 0x03, 0x1F, 0xAC, 0x02, 0x03,
+    0x1F, 0xAC, 0x02, 0x03, 0x1F, 0xAC, 0x02, 0x03, 0x1F, 0xAC, 0x02, 0x03, 0x1F, 0xAC, 0x02, 0x03,
+    0x1F, 0xAC, 0x02, 0x03, 0x1F, 0xAC, 0x02, 0x03, 0x1F, 0xAC, 0x02, 0x03, 0x1F, 0xAC, 0x02, 0x03,
+    0x1F, 0xAC, 0x02, 0x03, 0x1F, 0xAC, 0x02, 0x03, 0x1F, 0xAC, 0x02, 0x03, 0x1F, 0xAC, 0x02, 0x03,
+    0x1F, 0xAC, 0x02, 0x03, 0x1F, 0xAC, 0x02, 0x03, 0x1F, 0xAC, 0x02, 0x03, 0x1F, 0xAC, 0x02, 0x03,
+    0x1F, 0xAC, 0x02, 0x03, 0x1F, 0xAC, 0x02, 0x03, 0x1F, 0xAC, 0x02, 0x03, 0x1F, 0xAC, 0x02, 0x03,
+    0x1F, 0xAC, 0x02, 0x03, 0x1F, 0xAC, 0x02, 0x03, 0x1F, 0xAC, 0x02, 0x03, 0x1F, 0xAC, 0x02, 0x03,
+    0x1F, 0xAC, 0x02, 0x03, 0x1F, 0xAC, 0x02, 0x03, 0x1F, 0xAC, 0x02, 0x03, 0x1F, 0xAC, 0x02, 0x03,
+    0x1F, 0xAC, 0x02, 0x03, 0x1F, 0xAC, 0x02, 0x03, 0x1F, 0xAC, 0x02, 0x03, 0x1F, 0xAC, 0x02, 0x03,
+    0x1F, 0xAC, 0x02, 0x03, 0x1F, 0xAC, 0x02, 0x03, 0x1F, 0xAC, 0x02, 0x03, 0x1F, 0xAC, 0x02, 0x03,
+    0x1F, 0xAC, 0x02, 0x03, 0x1F, 0xAC, 0x02, 0x03, 0x1F, 0xAC, 0x02, 0x03, 0x1F, 0xAC, 0x02, 0x03,
+    0x1F, 0xAC, 0x02, 0x03, 0x1F, 0xAC, 0x02, 0x03, 0x1F, 0xAC, 0x02, 0x03, 0x1F, 0xAC, 0x02, 0x03,
+    0x1F, 0xAC, 0x02, 0x03, 0x1F, 0xAC, 0x02, 0x03, 0x1F, 0xAC, 0x02, 0x03, 0x1F, 0xAC, 0x02, 0x03,
+    0x1F, 0xAC, 0x02, 0x03, 0x1F, 0xAC, 0x02, 0x03, 0x1F, 0xAC, 0x02, 0x03, 0x1F, 0xAC, 0x02, 0x03,
+    0x1F, 0xAC, 0x02, 0x03, 0x1F, 0xAC, 0x02, 0x03, 0x1F, 0xAC, 0x02, 0x03, 0x1F, 0xAC, 0x02, 0x03,
+    0x1F, 0xAC, 0x02, 0x03, 0x1F, 0xAC, 0x02, 0x03, 0x1F, 0xAC, 0x02, 0x03, 0x1F, 0xAC, 0x02, 0x03,
+    0x1F, 0xAC, 0x02, 0x03, 0x1F, 0xAC, 0x02, 0x03, 0x1F, 0xAC, 0x02, 0x03, 0x1F, 0xAC, 0x02, 0x03,
+    0x1F, 0xAC, 0x02, 0x03, 0x1F, 0xAC, 0x02, 0x03, 0x1F, 0xAC, 0x02, 0x03, 0x1F, 0xAC, 0x02, 0x03,
+    0x1F, 0xAC, 0x02, 0x03, 0x1F, 0xAC, 0x02, 0x03, 0x1F, 0xAC, 0x02, 0x03, 0x1F, 0xAC, 0x02, 0x03,
+    0x1F, 0xAC, 0x02, 0x03, 0x1F, 0xAC, 0x02, 0x03, 0x1F, 0xAC, 0x02, 0x03, 0x1F, 0xAC, 0x02, 0x03,
+    0x1F, 0xAC, 0x02, 0x03, 0x1F, 0xAC, 0x02, 0x03, 0x1F, 0xAC, 0x02, 0x03, 0x1F, 0xAC, 0x02, 0x03,
+    0x1F, 0x49, 0x3F, 0x7A, 0x1F, 0x49, 0x03, 0x1F, 0x49, 0x3F, 0x7A, 0x1F, 0x49, 0x03, 0x1F, 0x49,
+    0x31, 0x4F, 0x76, 0x31, 0x1F, 0x49, 0x03, 0x1F, 0x49, 0x31, 0x4F, 0x76, 0x31, 0x1F, 0x49, 0x03,
+    0x1F, 0x4A, 0x30, 0x40, 0x1F, 0x74, 0x40, 0x30, 0x1F, 0x4A, 0x03, 0x1F, 0x4A, 0x30, 0x40, 0x1F,
+    0x74, 0x40, 0x30, 0x1F, 0x4A, 0x03, 0x1F, 0x4B, 0x30, 0x4F, 0x74, 0x30, 0x1F, 0x4B, 0x03, 0x1F,
+    0x4C, 0x30, 0x4F, 0x72, 0x30, 0x1F, 0x4C, 0x03, 0x1F, 0x4D, 0x30, 0x4F, 0x70, 0x30, 0x1F, 0x4D,
+    0x03, 0x1F, 0x4F, 0x30, 0x4F, 0x6C, 0x30, 0x1F, 0x4F, 0x03, 0x1F, 0x48, 0x31, 0x4F, 0x78, 0x31,
+    0x1F, 0x48, 0x03, 0x1F, 0x48, 0x31, 0x4F, 0x78, 0x31, 0x1F, 0x48, 0x03, 0x1F, 0x48, 0x31, 0x4F,
+    0x78, 0x31, 0x1F, 0x48, 0x03, 0x1F, 0x48, 0x31, 0x4F, 0x78, 0x31, 0x1F, 0x48, 0x03, 0x1F, 0x48,
+    0x31, 0x4F, 0x2B, 0x00, 0x4F, 0x01, 0x00, 0x4F, 0x2A, 0x31, 0x1F, 0x48, 0x03, 0x1F, 0x48, 0x31,
+    0x4F, 0x24, 0x08, 0x47, 0x00, 0x43, 0x00, 0x41, 0x00, 0x41, 0x00, 0x4F, 0x27, 0x31, 0x1F, 0x48,
+    0x03, 0x1F, 0x48, 0x31, 0x4F, 0x26, 0x00, 0x42, 0x00, 0x4A, 0x01, 0x42, 0x00, 0x40, 0x00, 0x40,
+    0x00, 0x4F, 0x28, 0x31, 0x1F, 0x48, 0x03, 0x1F, 0x48, 0x31, 0x4F, 0x26, 0x00, 0x42, 0x07, 0x44,
+    0x00, 0x44, 0x00, 0x41, 0x00, 0x4F, 0x27, 0x31, 0x1F, 0x48, 0x03, 0x1F, 0x48, 0x31, 0x4F, 0x26,
+    0x04, 0x45, 0x00, 0x41, 0x00, 0x44, 0x07, 0x4F, 0x26, 0x31, 0x1F, 0x48, 0x03, 0x1F, 0x48, 0x31,
+    0x4F, 0x26, 0x00, 0x42, 0x00, 0x40, 0x00, 0x43, 0x00, 0x42, 0x01, 0x42, 0x00, 0x44, 0x00, 0x4F,
+    0x27, 0x31, 0x1F, 0x48, 0x03, 0x1F, 0x48, 0x31, 0x4F, 0x26, 0x00, 0x42, 0x00, 0x40, 0x00, 0x42,
+    0x00, 0x44, 0x00, 0x42, 0x00, 0x44, 0x00, 0x4F, 0x27, 0x31, 0x1F, 0x48, 0x03, 0x1F, 0x48, 0x31,
+    0x4F, 0x26, 0x04, 0x40, 0x00, 0x42, 0x00, 0x46, 0x00, 0x40, 0x06, 0x4F, 0x27, 0x31, 0x1F, 0x48,
+    0x03, 0x1F, 0x48, 0x31, 0x4F, 0x26, 0x00, 0x42, 0x00, 0x41, 0x00, 0x41, 0x00, 0x45, 0x00, 0x41,
+    0x00, 0x44, 0x00, 0x4F, 0x27, 0x31, 0x1F, 0x48, 0x03, 0x1F, 0x48, 0x31, 0x4F, 0x26, 0x00, 0x42,
+    0x00, 0x41, 0x00, 0x40, 0x00, 0x45, 0x00, 0x42, 0x00, 0x44, 0x00, 0x4F, 0x27, 0x31, 0x1F, 0x48,
+    0x03, 0x1F, 0x48, 0x31, 0x4F, 0x26, 0x00, 0x42, 0x00, 0x42, 0x00, 0x44, 0x02, 0x42, 0x06, 0x4F,
+    0x27, 0x31, 0x1F, 0x48, 0x03, 0x1F, 0x48, 0x31, 0x4F, 0x26, 0x04, 0x41, 0x00, 0x40, 0x00, 0x45,
+    0x00, 0x42, 0x00, 0x44, 0x00, 0x4F, 0x27, 0x31, 0x1F, 0x48, 0x03, 0x1F, 0x48, 0x31, 0x4F, 0x24,
+    0x02, 0x42, 0x00, 0x41, 0x00, 0x41, 0x00, 0x44, 0x00, 0x42, 0x00, 0x44, 0x00, 0x4F, 0x27, 0x31,
+    0x1F, 0x48, 0x03, 0x1F, 0x48, 0x31, 0x4F, 0x25, 0x00, 0x43, 0x00, 0x40, 0x00, 0x42, 0x02, 0x42,
+    0x00, 0x42, 0x00, 0x44, 0x00, 0x4F, 0x27, 0x31, 0x1F, 0x48, 0x03, 0x1F, 0x48, 0x31, 0x4F, 0x2A,
+    0x01, 0x44, 0x00, 0x43, 0x00, 0x42, 0x00, 0x42, 0x00, 0x40, 0x00, 0x4F, 0x27, 0x31, 0x1F, 0x48,
+    0x03, 0x1F, 0x48, 0x31, 0x4F, 0x2A, 0x00, 0x4A, 0x00, 0x42, 0x00, 0x43, 0x00, 0x4F, 0x28, 0x31,
+    0x1F, 0x48, 0x03, 0x1F, 0x48, 0x31, 0x4F, 0x78, 0x31, 0x1F, 0x48, 0x03, 0x1F, 0x48, 0x31, 0x4F,
+    0x78, 0x31, 0x1F, 0x48, 0x03, 0x1F, 0x48, 0x31, 0x4F, 0x78, 0x31, 0x1F, 0x48, 0x03, 0x1F, 0x48,
+    0x31, 0x4F, 0x78, 0x31, 0x1F, 0x48, 0x03, 0x1F, 0x4F, 0x30, 0x4F, 0x6C, 0x30, 0x1F, 0x4F, 0x03,
+    0x1F, 0x4D, 0x30, 0x4F, 0x70, 0x30, 0x1F, 0x4D, 0x03, 0x1F, 0x4C, 0x30, 0x4F, 0x72, 0x30, 0x1F,
+    0x4C, 0x03, 0x1F, 0x4B, 0x30, 0x4F, 0x74, 0x30, 0x1F, 0x4B, 0x03, 0x1F, 0x4A, 0x30, 0x40, 0x5F,
+    0x74, 0x40, 0x30, 0x1F, 0x4A, 0x03, 0x1F, 0x4A, 0x30, 0x40, 0x5F, 0x74, 0x40, 0x30, 0x1F, 0x4A,
+    0x03, 0x1F, 0x49, 0x31, 0x4F, 0x76, 0x31, 0x1F, 0x49, 0x03, 0x1F, 0x49, 0x31, 0x4F, 0x76, 0x31,
+    0x1F, 0x49, 0x03, 0x1F, 0x49, 0x3F, 0x7A, 0x1F, 0x49, 0x03, 0x1F, 0x49, 0x3F, 0x7A, 0x1F, 0x49,
+    0x03, 0x1F, 0xAC, 0x02, 0x03, 0x1F, 0xAC, 0x02, 0x0F, 0xF2, 0x04,
+};
+
+static const RleImage pay_pieces[1] = {
+    {0, 0, 320, 240, 6, pay0_palette, pay0_data, 1931},
+};
+
+static const uint16_t frame0_palette[3] = {0x0000, 0xFFFF, 0xC618};
+
+static const uint8_t frame0_data[1111] = {
+    0x0F, 0xF2, 0x04, 0x1F, 0xAC, 0x02, 0x03, 0x1F, 0xAC, 0x02, 0x03, 0x1F, 0xAC, 0x02, 0x03, 0x1F,
+    0xAC, 0x02, 0x03, 0x1F, 0x3E, 0x20, 0x1F, 0xDD, 0x01, 0x03, 0x1F, 0x3E, 0x20, 0x1F, 0xDD, 0x01,
+    0x03, 0x1F, 0x3E, 0x20, 0x1F, 0xDD, 0x01, 0x03, 0x1F, 0x3E, 0x20, 0x1F, 0xDD, 0x01, 0x03, 0x1F,
+    0x3E, 0x20, 0x1F, 0xDD, 0x01, 0x03, 0x1F, 0x3E, 0x20, 0x1F, 0xDD, 0x01, 0x03, 0x1F, 0x3E, 0x20,
+    0x1F, 0xDD, 0x01, 0x03, 0x1F, 0x3E, 0x20, 0x1F, 0xDD, 0x01, 0x03, 0x1F, 0x3E, 0x20, 0x1F, 0xDD,
+    0x01, 0x03, 0x1F, 0x3E, 0x20, 0x1F, 0xDD, 0x01, 0x03, 0x1F, 0x3E, 0x20, 0x1F, 0xDD, 0x01, 0x03,
+    0x1F, 0x3E, 0x20, 0x1F, 0xDD, 0x01, 0x03, 0x1F, 0x3E, 0x20, 0x1F, 0xDD, 0x01, 0x03, 0x1F, 0x3E,
+    0x20, 0x1F, 0xDD, 0x01, 0x03, 0x1F, 0x3E, 0x20, 0x1F, 0xDD, 0x01, 0x03, 0x1F, 0x3E, 0x20, 0x1F,
+    0xDD, 0x01, 0x03, 0x1F, 0x3E, 0x20, 0x1F, 0xDD, 0x01, 0x03, 0x1F, 0x3E, 0x20, 0x1F, 0xDD, 0x01,
+    0x03, 0x1F, 0x3E, 0x20, 0x1F, 0xDD, 0x01, 0x03, 0x1F, 0x3E, 0x20, 0x1F, 0xDD, 0x01, 0x03, 0x1F,
+    0x3E, 0x20, 0x1F, 0xDD, 0x01, 0x03, 0x1F, 0x3E, 0x20, 0x1F, 0xDD, 0x01, 0x03, 0x1F, 0x3E, 0x20,
+    0x1F, 0xDD, 0x01, 0x03, 0x1F, 0x3E, 0x20, 0x1F, 0xDD, 0x01, 0x03, 0x1F, 0x3E, 0x20, 0x1F, 0xDD,
+    0x01, 0x03, 0x1F, 0x3E, 0x20, 0x1F, 0xDD, 0x01, 0x03, 0x1F, 0x3E, 0x20, 0x1F, 0xDD, 0x01, 0x03,
+    0x1F, 0x3E, 0x20, 0x1F, 0xDD, 0x01, 0x03, 0x1F, 0x3E, 0x20, 0x1F, 0xDD, 0x01, 0x03, 0x1F, 0x3E,
+    0x20, 0x1F, 0xDD, 0x01, 0x03, 0x1F, 0x3E, 0x20, 0x1F, 0xDD, 0x01, 0x03, 0x1F, 0x3E, 0x20, 0x1F,
+    0xDD, 0x01, 0x03, 0x1F, 0x3E, 0x20, 0x1F, 0xDD, 0x01, 0x03, 0x1F, 0x3E, 0x20, 0x1F, 0xDD, 0x01,
+    0x03, 0x1F, 0x3E, 0x20, 0x1F, 0xDD, 0x01, 0x03, 0x1F, 0x3E, 0x20, 0x1F, 0xDD, 0x01, 0x03, 0x1F,
+    0x3E, 0x20, 0x1F, 0xDD, 0x01, 0x03, 0x1F, 0x3E, 0x20, 0x1F, 0xDD, 0x01, 0x03, 0x1F, 0x3E, 0x20,
+    0x1F, 0xDD, 0x01, 0x03, 0x1F, 0x3E, 0x20, 0x1F, 0xDD, 0x01, 0x03, 0x1F, 0x3E, 0x20, 0x1F, 0xDD,
+    0x01, 0x03, 0x1F, 0x3E, 0x20, 0x1F, 0xDD, 0x01, 0x03, 0x1F, 0x3E, 0x20, 0x1F, 0xDD, 0x01, 0x03,
+    0x1F, 0x3E, 0x20, 0x1F, 0xDD, 0x01, 0x03, 0x1F, 0x3E, 0x20, 0x1F, 0xDD, 0x01, 0x03, 0x1F, 0x3E,
+    0x20, 0x1F, 0xDD, 0x01, 0x03, 0x1F, 0x3E, 0x20, 0x1F, 0xDD, 0x01, 0x03, 0x1F, 0x3E, 0x20, 0x1F,
+    0xDD, 0x01, 0x03, 0x1F, 0x3E, 0x20, 0x1F, 0xDD, 0x01, 0x03, 0x1F, 0x3E, 0x20, 0x1F, 0xDD, 0x01,
+    0x03, 0x1F, 0x3E, 0x20, 0x1F, 0xDD, 0x01, 0x03, 0x1F, 0x3E, 0x20, 0x1F, 0xDD, 0x01, 0x03, 0x1F,
+    0x3E, 0x20, 0x1F, 0xDD, 0x01, 0x03, 0x1F, 0x3E, 0x20, 0x1F, 0xDD, 0x01, 0x03, 0x1F, 0xAC, 0x02,
+    0x03, 0x1F, 0xAC, 0x02, 0x03, 0x1F, 0xAC, 0x02, 0x03, 0x1F, 0xAC, 0x02, 0x03, 0x1F, 0xAC, 0x02,
+    0x03, 0x1F, 0xAC, 0x02, 0x01, 0x2F, 0xB0, 0x02, 0x01, 0x1F, 0xAC, 0x02, 0x03, 0x1F, 0xAC, 0x02,
+    0x03, 0x1F, 0xAC, 0x02, 0x03, 0x1F, 0xAC, 0x02, 0x03, 0x1F, 0xAC, 0x02, 0x03, 0x1F, 0xAC, 0x02,
+    0x03, 0x1F, 0xAC, 0x02, 0x03, 0x1F, 0xAC, 0x02, 0x03, 0x1F, 0xAC, 0x02, 0x03, 0x1F, 0xAC, 0x02,
+    0x03, 0x1F, 0xAC, 0x02, 0x03, 0x1F, 0xAC, 0x02, 0x03, 0x1F, 0xAC, 0x02, 0x03, 0x1F, 0xAC, 0x02,
+    0x03, 0x1F, 0xAC, 0x02, 0x03, 0x1F, 0xAC, 0x02, 0x03, 0x1F, 0xAC, 0x02, 0x03, 0x1F, 0xAC, 0x02,
+    0x03, 0x1F, 0xAC, 0x02, 0x03, 0x1F, 0xAC, 0x02, 0x03, 0x1F, 0xAC, 0x02, 0x03, 0x1F, 0xAC, 0x02,
+    0x03, 0x1F, 0xAC, 0x02, 0x03, 0x1F, 0xAC, 0x02, 0x03, 0x1F, 0xAC, 0x02, 0x03, 0x1F, 0xAC, 0x02,
+    0x03, 0x1F, 0xAC, 0x02, 0x03, 0x1F, 0xAC, 0x02, 0x03, 0x1F, 0xAC, 0x02, 0x03, 0x1F, 0xAC, 0x02,
+    0x03, 0x1F, 0xAC, 0x02, 0x03, 0x1F, 0xAC, 0x02, 0x03, 0x1F, 0xAC, 0x02, 0x03, 0x1F, 0xAC, 0x02,
+    0x03, 0x1F, 0xAC, 0x02, 0x03, 0x1F, 0xAC, 0x02, 0x03, 0x1F, 0xAC, 0x02, 0x03, 0x1F, 0xAC, 0x02,
+    0x03, 0x1F, 0xAC, 0x02, 0x03, 0x1F, 0xAC, 0x02, 0x03, 0x1F, 0xAC, 0x02, 0x03, 0x1F, 0xAC, 0x02,
+    0x03, 0x1F, 0xAC, 0x02, 0x03, 0x1F, 0xAC, 0x02, 0x03, 0x1F, 0xAC, 0x02, 0x03, 0x1F, 0xAC, 0x02,
+    0x03, 0x1F, 0xAC, 0x02, 0x03, 0x1F, 0xAC, 0x02, 0x03, 0x1F, 0xAC, 0x02, 0x03, 0x1F, 0xAC, 0x02,
+    0x03, 0x1F, 0xAC, 0x02, 0x03, 0x1F, 0xAC, 0x02, 0x03, 0x1F, 0xAC, 0x02, 0x03, 0x1F, 0xAC, 0x02,
+    0x03, 0x1F, 0xAC, 0x02, 0x03, 0x1F, 0xAC, 0x02, 0x03, 0x1F, 0xAC, 0x02, 0x03, 0x1F, 0xAC, 0x02,
+    0x03, 0x1F, 0xAC, 0x02, 0x03, 0x1F, 0xAC, 0x02, 0x03, 0x1F, 0xAC, 0x02, 0x03, 0x1F, 0xAC, 0x02,
+    0x03, 0x1F, 0xAC, 0x02, 0x03, 0x1F, 0xAC, 0x02, 0x03, 0x1F, 0xAC, 0x02, 0x03, 0x1F, 0xAC, 0x02,
+    0x03, 0x1F, 0xAC, 0x02, 0x03, 0x1F, 0xAC, 0x02, 0x03, 0x1F, 0xAC, 0x02, 0x03, 0x1F, 0xAC, 0x02,
+    0x03, 0x1F, 0xAC, 0x02, 0x03, 0x1F, 0xAC, 0x02, 0x03, 0x1F, 0xAC, 0x02, 0x03, 0x1F, 0xAC, 0x02,
+    0x03, 0x1F, 0xAC, 0x02, 0x03, 0x1F, 0xAC, 0x02, 0x03, 0x1F, 0xAC, 0x02, 0x03, 0x1F, 0xAC, 0x02,
+    0x03, 0x1F, 0xAC, 0x02, 0x03, 0x1F, 0xAC, 0x02, 0x03, 0x1F, 0xAC, 0x02, 0x03, 0x1F, 0xAC, 0x02,
+    0x03, 0x1F, 0xAC, 0x02, 0x03, 0x1F, 0xAC, 0x02, 0x03, 0x1F, 0xAC, 0x02, 0x03, 0x1F, 0xAC, 0x02,
+    0x03, 0x1F, 0xAC, 0x02, 0x03, 0x1F, 0xAC, 0x02, 0x03, 0x1F, 0xAC, 0x02, 0x03, 0x1F, 0xAC, 0x02,
+    0x03, 0x1F, 0xAC, 0x02, 0x03, 0x1F, 0xAC, 0x02, 0x03, 0x1F, 0xAC, 0x02, 0x03, 0x1F, 0xAC, 0x02,
+    0x03, 0x1F, 0xAC, 0x02, 0x03, 0x1F, 0xAC, 0x02, 0x03, 0x1F, 0xAC, 0x02, 0x03, 0x1F, 0xAC, 0x02,
+    0x03, 0x1F, 0xAC, 0x02, 0x03, 0x1F, 0xAC, 0x02, 0x03, 0x1F, 0xAC, 0x02, 0x03, 0x1F, 0xAC, 0x02,
+    0x03, 0x1F, 0xAC, 0x02, 0x03, 0x1F, 0xAC, 0x02, 0x03, 0x1F, 0xAC, 0x02, 0x03, 0x1F, 0xAC, 0x02,
+    0x03, 0x1F, 0xAC, 0x02, 0x03, 0x1F, 0xAC, 0x02, 0x03, 0x1F, 0xAC, 0x02, 0x03, 0x1F, 0xAC, 0x02,
+    0x03, 0x1F, 0xAC, 0x02, 0x03, 0x1F, 0xAC, 0x02, 0x03, 0x1F, 0xAC, 0x02, 0x03, 0x1F, 0xAC, 0x02,
+    0x03, 0x1F, 0xAC, 0x02, 0x03, 0x1F, 0xAC, 0x02, 0x03, 0x1F, 0xAC, 0x02, 0x03, 0x1F, 0xAC, 0x02,
+    0x03, 0x1F, 0xAC, 0x02, 0x03, 0x1F, 0xAC, 0x02, 0x03, 0x1F, 0xAC, 0x02, 0x03, 0x1F, 0xAC, 0x02,
+    0x03, 0x1F, 0xAC, 0x02, 0x03, 0x1F, 0xAC, 0x02, 0x03, 0x1F, 0xAC, 0x02, 0x03, 0x1F, 0xAC, 0x02,
+    0x03, 0x1F, 0xAC, 0x02, 0x03, 0x1F, 0xAC, 0x02, 0x03, 0x1F, 0xAC, 0x02, 0x03, 0x1F, 0xAC, 0x02,
+    0x03, 0x1F, 0xAC, 0x02, 0x03, 0x1F, 0xAC, 0x02, 0x03, 0x1F, 0xAC, 0x02, 0x03, 0x1F, 0xAC, 0x02,
+    0x03, 0x1F, 0xAC, 0x02, 0x03, 0x1F, 0xAC, 0x02, 0x03, 0x1F, 0xAC, 0x02, 0x03, 0x1F, 0xAC, 0x02,
+    0x03, 0x1F, 0xAC, 0x02, 0x03, 0x1F, 0xAC, 0x02, 0x03, 0x1F, 0xAC, 0x02, 0x03, 0x1F, 0xAC, 0x02,
+    0x03, 0x1F, 0xAC, 0x02, 0x03, 0x1F, 0xAC, 0x02, 0x03, 0x1F, 0xAC, 0x02, 0x03, 0x1F, 0xAC, 0x02,
+    0x03, 0x1F, 0xAC, 0x02, 0x03, 0x1F, 0xAC, 0x02, 0x03, 0x1F, 0xAC, 0x02, 0x03, 0x1F, 0xAC, 0x02,
+    0x03, 0x1F, 0xAC, 0x02, 0x03, 0x1F, 0xAC, 0x02, 0x03, 0x1F, 0xAC, 0x02, 0x03, 0x1F, 0xAC, 0x02,
+    0x03, 0x1F, 0xAC, 0x02, 0x03, 0x1F, 0xAC, 0x02, 0x03, 0x1F, 0xAC, 0x02, 0x03, 0x1F, 0xAC, 0x02,
+    0x03, 0x1F, 0xAC, 0x02, 0x03, 0x1F, 0xAC, 0x02, 0x03, 0x1F, 0xAC, 0x02, 0x03, 0x1F, 0xAC, 0x02,
+    0x03, 0x1F, 0xAC, 0x02, 0x03, 0x1F, 0xAC, 0x02, 0x03, 0x1F, 0xAC, 0x02, 0x03, 0x1F, 0xAC, 0x02,
+    0x03, 0x1F, 0xAC, 0x02, 0x03, 0x1F, 0xAC, 0x02, 0x03, 0x1F, 0xAC, 0x02, 0x03, 0x1F, 0xAC, 0x02,
+    0x03, 0x1F, 0xAC, 0x02, 0x0F, 0xF2, 0x04,
+};
+
+static const RleImage frame_pieces[1] = {
+    {0, 0, 320, 240, 3, frame0_palette, frame0_data, 1111},
+};
+
+const ScreenSnapshot &screenSnapshot(ScreenLayer layer) {
+  static const ScreenSnapshot snapshots[ScreenLayerCount] = {
+      {height_pieces, 4},
+      {weigh_pieces, 1},
+      {pay_pieces, 1},
+      {frame_pieces, 1},
+  };
+  return snapshots[(int)layer];
+}
+
+}  // namespace ui
+}  // namespace aiw
@@ -0,0 +1,141 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+namespace aiw {
+
+struct SettlingEstimate {
+  int32_t value;
+  int32_t bound;
+  bool valid;
+  bool confident;
+};
+
+// Predicts where a damped step response will settle. The recent samples are split
+// into three equal blocks; for a first-order response y = A + B * r^t the block means
+// form a geometric sequence, so Aitken extrapolation gives A = S2 + d2^2 / (d1 - d2).
+// The estimate is confident once consecutive predictions covering a quarter of the
+// history (and at least `agree` of them) fall within toleranceCounts of each other;
+// bound is their spread. A large reversal (the peak after a step-on ramp, or an
+// overshoot) restarts the history so the blocks only see the decaying part of the
+// response.
+class SettlingPredictor {
+public:
+  static constexpr int MaxSamples = 24;
+  static constexpr int MaxAgree = 16;
+
+  void configure(int32_t toleranceCounts, uint8_t minSamples = 4, uint8_t agree = 3) {
+    if (toleranceCounts < 1) toleranceCounts = 1;
+    if (minSamples < 3) minSamples = 3;
+    if (minSamples > MaxSamples) minSamples = MaxSamples;
+    if (agree < 2) agree = 2;
+    if (agree > MaxAgree) agree = MaxAgree;
+    tolerance_ = toleranceCounts;
+    minSamples_ = minSamples;
+    agree_ = agree;
+    reset();
+  }
+  int32_t tolerance() const { return tolerance_; }
+
+  void reset() {
+    count_ = 0;
+    head_ = 0;
+    predictions_ = 0;
+    trend_ = 0;
+    last_ = SettlingEstimate{};
+  }
+
+  const SettlingEstimate &push(int32_t x) {
+    if (count_ > 0) {
+      int32_t prev = at(0);
+      int64_t d = (int64_t)x - prev;
+      int64_t big = (int64_t)tolerance_ * 4;
+      if (d > big || d < -big) {
+        int8_t dir = d > 0 ? 1 : -1;
+        if (trend_ != 0 && dir != trend_) {
+          samples_[0] = prev;
+          head_ = 1;
+          count_ = 1;
+          predictions_ = 0;
+        }
+        trend_ = dir;
+      }
+    }
+    samples_[head_] = x;
+    head_ = (uint8_t)((head_ + 1) % MaxSamples);
+    if (count_ < MaxSamples) count_++;
+
+    SettlingEstimate est{};
+    int32_t a = 0;
+    if (count_ >= minSamples_ && extrapolate(a)) {
+      est.valid = true;
+      est.value = a;
+      history_[predictions_ % MaxAgree] = a;
+      predictions_++;
+    } else {
+      predictions_ = 0;
+    }
+    // Predictions must agree over at least a quarter of the history, so a slow sway is
+    // not mistaken for convergence just because three neighbouring fits line up.
+    int span = count_ / 4 > agree_ ? count_ / 4 : agree_;
+    if (est.valid && predictions_ >= (uint32_t)span) {
+      int32_t lo = est.value;
+      int32_t hi = est.value;
+      for (int i = 0; i < span; ++i) {
+        int32_t p = history_[(predictions_ - 1 - i) % MaxAgree];
+        if (p < lo) lo = p;
+        if (p > hi) hi = p;
+      }
+      est.bound = hi - lo;
+      est.confident = est.bound <= tolerance_;
+    }
+    last_ = est;
+    return last_;
+  }
+
+  const SettlingEstimate &estimate() const { return last_; }
+
+private:
+  int32_t at(int back) const { return samples_[(head_ + MaxSamples - 1 - back) % MaxSamples]; }
+
+  bool extrapolate(int32_t &out) const {
+    int m = count_ / 3;
+    int64_t t[3] = {0, 0, 0};
+    for (int k = 0; k < 3; ++k) {
+      for (int i = 0; i < m; ++i) t[2 - k] += at(k * m + i);
+    }
+    int64_t e1 = t[1] - t[0];
+    int64_t e2 = t[2] - t[1];
+    int64_t flat = (int64_t)tolerance_ * m;
+    int64_t abs1 = e1 < 0 ? -e1 : e1;
+    int64_t abs2 = e2 < 0 ? -e2 : e2;
+    int64_t sum;
+    if (abs1 <= flat && abs2 <= flat) {
+      sum = t[2];
+    } else if ((e1 < 0) != (e2 < 0)) {
+      // Overshoot: average the last two blocks and let the agreement check decide.
+      sum = (t[1] + t[2]) / 2;
+    } else if (abs2 * 10 >= abs1 * 9) {
+      // Ratio above 0.9: still ramping or too slow to extrapolate reliably.
+      return false;
+    } else {
+      sum = t[2] + e2 * e2 / (e1 - e2);
+    }
+    out = (int32_t)(sum >= 0 ? (sum + m / 2) / m : -((-sum + m / 2) / m));
+    return true;
+  }
+
+  int32_t tolerance_ = 50;
+  uint8_t minSamples_ = 4;
+  uint8_t agree_ = 3;
+  int32_t samples_[MaxSamples] = {0};
+  uint8_t count_ = 0;
+  uint8_t head_ = 0;
+  uint32_t predictions_ = 0;
+  int8_t trend_ = 0;
+  int32_t history_[MaxAgree] = {0};
+  SettlingEstimate last_{};
+};
+
+}  // namespace aiw
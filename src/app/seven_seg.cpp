@@ -8,43 +8,49 @@ void SevenSeg::clearRect(int x, int y, int w, int h, uint16_t bg) {
   display_.fillRect(x, y, w, h, bg);
 }
 
-static void segRect(DisplaySt7789 &display, int x, int y, int w, int h, uint16_t color) {
-  display.fillRect(x, y, w, h, color);
+static constexpr uint8_t DotBit = 0x80;
+
+static uint8_t segmentsOf(char ch) {
+  static const uint8_t map[10] = {
+    0b00111111, 0b00000110, 0b01011011, 0b01001111, 0b01100110,
+    0b01101101, 0b01111101, 0b00000111, 0b01111111, 0b01101111
+  };
+  if (ch >= '0' && ch <= '9') return map[ch - '0'];
+  if (ch == '-') return 0b01000000;
+  if (ch == '.') return DotBit;
+  return 0;
 }
 
-void SevenSeg::drawChar(int x, int y, char ch, int scale, uint16_t on, uint16_t off) {
-  if (scale < 1) scale = 1;
+static int popcount8(uint8_t v) {
+  int n = 0;
+  for (; v; v &= (uint8_t)(v - 1)) ++n;
+  return n;
+}
+
+// The dot overlaps segments c and d, so it never shares a cell with them.
+void SevenSeg::segment(int x, int y, int bit, int scale, uint16_t color) {
   const int t = scale;
   const int w = 6 * scale;
   const int h = 10 * scale;
-
-  segRect(display_, x, y, w, h, off);
-
-  if (ch == '.') {
-    segRect(display_, x + w - t - 1, y + h - t - 1, t, t, on);
-    return;
+  switch (bit) {
+    case 0: display_.fillRect(x + t, y, w - 2 * t, t, color); return;
+    case 1: display_.fillRect(x + w - t, y + t, t, (h / 2) - t, color); return;
+    case 2: display_.fillRect(x + w - t, y + (h / 2), t, (h / 2) - t, color); return;
+    case 3: display_.fillRect(x + t, y + h - t, w - 2 * t, t, color); return;
+    case 4: display_.fillRect(x, y + (h / 2), t, (h / 2) - t, color); return;
+    case 5: display_.fillRect(x, y + t, t, (h / 2) - t, color); return;
+    case 6: display_.fillRect(x + t, y + (h / 2) - (t / 2), w - 2 * t, t, color); return;
+    case 7: display_.fillRect(x + w - t - 1, y + h - t - 1, t, t, color); return;
   }
+}
 
-  uint8_t segs = 0;
-  if (ch >= '0' && ch <= '9') {
-    static const uint8_t map[10] = {
-      0b00111111, 0b00000110, 0b01011011, 0b01001111, 0b01100110,
-      0b01101101, 0b01111101, 0b00000111, 0b01111111, 0b01101111
-    };
-    segs = map[ch - '0'];
-  } else if (ch == '-') {
-    segs = 0b01000000;
-  } else {
-    return;
+void SevenSeg::drawChar(int x, int y, char ch, int scale, uint16_t on, uint16_t off) {
+  if (scale < 1) scale = 1;
+  display_.fillRect(x, y, 6 * scale, 10 * scale, off);
+  uint8_t segs = segmentsOf(ch);
+  for (int bit = 0; bit < 8; ++bit) {
+    if (segs & (1u << bit)) segment(x, y, bit, scale, on);
   }
-
-  if (segs & 0b00000001) segRect(display_, x + t, y, w - 2 * t, t, on);
-  if (segs & 0b00000010) segRect(display_, x + w - t, y + t, t, (h / 2) - t, on);
-  if (segs & 0b00000100) segRect(display_, x + w - t, y + (h / 2), t, (h / 2) - t, on);
-  if (segs & 0b00001000) segRect(display_, x + t, y + h - t, w - 2 * t, t, on);
-  if (segs & 0b00010000) segRect(display_, x, y + (h / 2), t, (h / 2) - t, on);
-  if (segs & 0b00100000) segRect(display_, x, y + t, t, (h / 2) - t, on);
-  if (segs & 0b01000000) segRect(display_, x + t, y + (h / 2) - (t / 2), w - 2 * t, t, on);
 }
 
 void SevenSeg::drawText(int x, int y, const char *text, int scale, uint16_t on, uint16_t off) {
@@ -56,5 +62,67 @@ void SevenSeg::drawText(int x, int y, const char *text, int scale, uint16_t on,
   }
 }
 
-}  // namespace aiw
+void SevenSeg::drawTextDiff(SevenSegState &state, int x, int y, const char *text, int scale, uint16_t on, uint16_t off) {
+  if (scale < 1) scale = 1;
+  size_t len = strlen(text);
+  if (len > (size_t)SevenSegState::MaxCells) {
+    if (state.valid) clearRect(state.x, state.y, state.count * 7 * state.scale, 10 * state.scale, state.off);
+    drawText(x, y, text, scale, on, off);
+    state.valid = false;
+    state.rects = 0;
+    return;
+  }
+
+  bool same = state.valid && state.x == x && state.y == y && state.scale == scale && state.on == on && state.off == off;
+  if (!same) {
+    int rects = 0;
+    if (state.valid) {
+      clearRect(state.x, state.y, state.count * 7 * state.scale, 10 * state.scale, state.off);
+      ++rects;
+    }
+    drawText(x, y, text, scale, on, off);
+    for (size_t i = 0; i < len; ++i) {
+      state.cells[i] = segmentsOf(text[i]);
+      rects += 1 + popcount8(state.cells[i]);
+    }
+    state.valid = true;
+    state.x = x;
+    state.y = y;
+    state.scale = scale;
+    state.on = on;
+    state.off = off;
+    state.count = (uint8_t)len;
+    state.rects = (uint16_t)rects;
+    return;
+  }
+
+  // Off before on within a cell, so a dot turning off cannot erase a segment.
+  int rects = 0;
+  int cells = (int)len > state.count ? (int)len : state.count;
+  for (int i = 0; i < cells; ++i) {
+    uint8_t now = i < (int)len ? segmentsOf(text[i]) : 0;
+    // A cell the readout did not reach before may hold anything.
+    if (i >= state.count) {
+      drawChar(x + i * 7 * scale, y, text[i], scale, on, off);
+      rects += 1 + popcount8(now);
+      state.cells[i] = now;
+      continue;
+    }
+    uint8_t was = state.cells[i];
+    uint8_t changed = (uint8_t)(was ^ now);
+    if (!changed) continue;
+    int cx = x + i * 7 * scale;
+    for (int bit = 0; bit < 8; ++bit) {
+      if (changed & was & (1u << bit)) segment(cx, y, bit, scale, off);
+    }
+    for (int bit = 0; bit < 8; ++bit) {
+      if (changed & now & (1u << bit)) segment(cx, y, bit, scale, on);
+    }
+    rects += popcount8(changed);
+    state.cells[i] = now;
+  }
+  state.count = (uint8_t)len;
+  state.rects = (uint16_t)rects;
+}
 
+}  // namespace aiw
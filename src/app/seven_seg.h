@@ -5,16 +5,39 @@
 
 namespace aiw {
 
+// Segment bits last drawn in each cell of one readout. Bits 0-6 are segments a-g,
+// bit 7 is the decimal point, which always has a cell of its own.
+struct SevenSegState {
+  static constexpr int MaxCells = 12;
+  bool valid = false;
+  int x = 0;
+  int y = 0;
+  int scale = 0;
+  uint16_t on = 0;
+  uint16_t off = 0;
+  uint8_t count = 0;
+  uint8_t cells[MaxCells] = {};
+  // fillRect calls made by the last update.
+  uint16_t rects = 0;
+
+  // After something else has drawn over the readout.
+  void invalidate() { valid = false; }
+};
+
 class SevenSeg {
 public:
   explicit SevenSeg(DisplaySt7789 &display);
   void drawText(int x, int y, const char *text, int scale, uint16_t on, uint16_t off);
+  // Like drawText, but once state is valid only the segments that flipped since the
+  // last call are repainted. Cells the new text no longer reaches are blanked, new
+  // ones drawn whole. Any change of position, scale or colours redraws it in full.
+  void drawTextDiff(SevenSegState &state, int x, int y, const char *text, int scale, uint16_t on, uint16_t off);
   void clearRect(int x, int y, int w, int h, uint16_t bg);
 
 private:
   void drawChar(int x, int y, char ch, int scale, uint16_t on, uint16_t off);
+  void segment(int x, int y, int bit, int scale, uint16_t color);
   DisplaySt7789 &display_;
 };
 
 }  // namespace aiw
-
@@ -0,0 +1,180 @@
+#include "app/simulated_adc.h"
+
+#include <math.h>
+
+namespace aiw {
+
+static constexpr float TwoPi = 6.2831853f;
+
+SimulatedAdc::SimulatedAdc(const SimulatedAdcConfig &cfg) {
+  configure(cfg);
+}
+
+void SimulatedAdc::configure(const SimulatedAdcConfig &cfg) {
+  cfg_ = cfg;
+  if (cfg_.settleTauMs < 1.0f) cfg_.settleTauMs = 1.0f;
+  restart();
+}
+
+void SimulatedAdc::setLoads(const SimulatedLoad *loads, size_t count, uint32_t loopMs) {
+  loads_ = loads;
+  loadCount_ = count;
+  loopMs_ = loopMs;
+  trace_ = nullptr;
+  traceCount_ = 0;
+  restart();
+}
+
+void SimulatedAdc::setTrace(const int32_t *raw, size_t count) {
+  trace_ = raw;
+  traceCount_ = count;
+  loads_ = nullptr;
+  loadCount_ = 0;
+  restart();
+}
+
+void SimulatedAdc::restart() {
+  rng_ = cfg_.seed ? cfg_.seed : 1;
+  hasSpare_ = false;
+  nowUs_ = 0;
+  conversions_ = 0;
+  traceIndex_ = 0;
+  loadKg_ = 0.0f;
+  settleRemaining_ = 0;
+  poweredDown_ = false;
+}
+
+bool SimulatedAdc::finished() const {
+  return trace_ && traceIndex_ >= traceCount_;
+}
+
+// xorshift32: fast, and identical on the host and the ESP32.
+uint32_t SimulatedAdc::nextRandom() {
+  uint32_t x = rng_;
+  x ^= x << 13;
+  x ^= x >> 17;
+  x ^= x << 5;
+  rng_ = x;
+  return x;
+}
+
+float SimulatedAdc::gaussian() {
+  if (hasSpare_) {
+    hasSpare_ = false;
+    return spare_;
+  }
+  float u1 = ((float)(nextRandom() >> 8) + 1.0f) / 16777217.0f;
+  float u2 = (float)(nextRandom() >> 8) / 16777216.0f;
+  float r = sqrtf(-2.0f * logf(u1));
+  spare_ = r * sinf(TwoPi * u2);
+  hasSpare_ = true;
+  return r * cosf(TwoPi * u2);
+}
+
+// Sum of damped step responses to every load change so far. A looping scenario should
+// end at the load it starts from, or the wrap shows up as a step.
+float SimulatedAdc::signalKg(uint32_t tMs) {
+  if (loopMs_ > 0) tMs %= loopMs_;
+  float tau = cfg_.settleTauMs;
+  float kg = 0.0f;
+  float prev = 0.0f;
+  loadKg_ = 0.0f;
+  for (size_t i = 0; i < loadCount_ && loads_[i].atMs <= tMs; ++i) {
+    const SimulatedLoad &l = loads_[i];
+    float s = (float)(tMs - l.atMs);
+    float delta = l.kg - prev;
+    prev = l.kg;
+    loadKg_ = l.kg;
+    if (s > 20.0f * tau) {
+      kg += delta;
+    } else {
+      float decay = expf(-s / tau);
+      kg += delta * (1.0f - decay + cfg_.overshoot * decay * sinf(TwoPi * cfg_.ringHz * s / 1000.0f));
+    }
+    bool active = i + 1 == loadCount_ || loads_[i + 1].atMs > tMs;
+    if (active && l.swayKg != 0.0f) {
+      float ramp = s < tau ? s / tau : 1.0f;
+      kg += ramp * l.swayKg * sinf(TwoPi * l.swayHz * s / 1000.0f);
+    }
+  }
+  return kg;
+}
+
+int32_t SimulatedAdc::readConversion() {
+  if (!isReady()) return INT32_MIN;
+  nowUs_ += conversionPeriodUs();
+  conversions_++;
+  int32_t v;
+  if (trace_) {
+    v = trace_[traceIndex_++];
+  } else {
+    float minutes = (float)nowUs_ / 60e6f;
+    float sigma = cfg_.noiseCounts * (rate_ >= 80 ? 1.8f : 1.0f);
+    float counts = signalKg((uint32_t)(nowUs_ / 1000u)) * cfg_.countsPerKg * (float)gain_ / 128.0f;
+    counts += (float)cfg_.zeroCounts + cfg_.driftCountsPerMin * minutes + sigma * gaussian();
+    if (cfg_.spikeRate > 0.0f && (float)nextRandom() < cfg_.spikeRate * 4294967296.0f) {
+      counts += (nextRandom() & 1u) ? (float)cfg_.spikeCounts : -(float)cfg_.spikeCounts;
+    }
+    if (counts > 8388607.0f) counts = 8388607.0f;
+    if (counts < -8388608.0f) counts = -8388608.0f;
+    v = (int32_t)lroundf(counts);
+  }
+  if (settleRemaining_ > 0) {
+    settleRemaining_--;
+    return INT32_MIN;
+  }
+  return v;
+}
+
+// Simulated time never stalls, so the timeout only matters once a trace runs out.
+int32_t SimulatedAdc::readRaw(uint32_t) {
+  while (isReady()) {
+    int32_t v = readConversion();
+    if (v != INT32_MIN) return v;
+  }
+  return INT32_MIN;
+}
+
+int32_t SimulatedAdc::readAverage(int samples, uint32_t timeoutMs) {
+  if (samples < 1) samples = 1;
+  int64_t sum = 0;
+  int got = 0;
+  for (int i = 0; i < samples; ++i) {
+    int32_t v = readRaw(timeoutMs);
+    if (v == INT32_MIN) continue;
+    sum += v;
+    ++got;
+  }
+  if (got == 0) return INT32_MIN;
+  return (int32_t)(sum / got);
+}
+
+void SimulatedAdc::tare(int samples, uint32_t timeoutMs) {
+  int32_t v = readAverage(samples, timeoutMs);
+  if (v != INT32_MIN) offset_ = v;
+}
+
+// Any power of two up to 128, which covers both the HX711 and the NAU7802 PGA.
+bool SimulatedAdc::setPgaGain(int gain) {
+  if (gain < 1 || gain > 128 || (gain & (gain - 1)) != 0) return false;
+  if (gain == gain_) return true;
+  gain_ = gain;
+  settleRemaining_ = SettleSamples + 1;
+  return true;
+}
+
+bool SimulatedAdc::setRateSps(int sps) {
+  if (sps < 1 || sps > 1000) return false;
+  if (sps == rate_) return true;
+  rate_ = sps;
+  settleRemaining_ = SettleSamples;
+  return true;
+}
+
+void SimulatedAdc::powerUp() {
+  if (!poweredDown_) return;
+  poweredDown_ = false;
+  settleRemaining_ = SettleSamples + 1;
+}
+
+}  // namespace aiw
@@ -0,0 +1,115 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "app/load_cell_adc.h"
+
+namespace aiw {
+
+// A load change at atMs; the platform then responds like a damped step.
+struct SimulatedLoad {
+  uint32_t atMs;
+  float kg;
+  // Body sway riding on this load, peak kg at swayHz; 0 for a still load.
+  float swayKg;
+  float swayHz;
+};
+
+struct SimulatedAdcConfig {
+  float countsPerKg = 20000.0f;
+  int32_t zeroCounts = 100000;
+  // Input noise sigma at 10 sps; 80 sps scales it by the datasheet's 90/50 nV ratio.
+  float noiseCounts = 60.0f;
+  float driftCountsPerMin = 0.0f;
+  // Probability per conversion of a single-sample glitch of +-spikeCounts.
+  float spikeRate = 0.0f;
+  int32_t spikeCounts = 40000;
+  // Mechanical response to a load change: first-order rise plus decaying ringing.
+  float settleTauMs = 250.0f;
+  float overshoot = 0.05f;
+  float ringHz = 2.5f;
+  uint32_t seed = 1;
+};
+
+// Deterministic converter for host runs. Time advances one conversion period per read,
+// so a run depends only on the seed, never on the wall clock. The signal comes either
+// from a load scenario or from replaying captured raw conversions.
+class SimulatedAdc : public LoadCellAdc {
+public:
+  explicit SimulatedAdc(const SimulatedAdcConfig &cfg = SimulatedAdcConfig{});
+
+  void configure(const SimulatedAdcConfig &cfg);
+  const SimulatedAdcConfig &config() const { return cfg_; }
+  // Loads must be sorted by atMs; the array is not copied. loopMs > 0 repeats the scenario.
+  void setLoads(const SimulatedLoad *loads, size_t count, uint32_t loopMs = 0);
+  // Replays raw conversions as captured; reads stop being ready at the end.
+  void setTrace(const int32_t *raw, size_t count);
+  void restart();
+
+  uint64_t nowUs() const { return nowUs_; }
+  uint32_t conversions() const { return conversions_; }
+  // Ideal load in kg at the last conversion, before noise and response.
+  float loadKg() const { return loadKg_; }
+  bool finished() const;
+
+  const char *name() const override { return "sim"; }
+  void begin() override { restart(); }
+  bool isReady() const override { return !poweredDown_ && !finished(); }
+  int32_t readConversion() override;
+  bool settling() const override { return settleRemaining_ > 0; }
+  int32_t readRaw(uint32_t timeoutMs) override;
+  int32_t readAverage(int samples, uint32_t timeoutMs) override;
+  void tare(int samples, uint32_t timeoutMs) override;
+
+  bool setPgaGain(int gain) override;
+  int pgaGain() const override { return gain_; }
+  bool setRateSps(int sps) override;
+  int rateSps() const override { return rate_; }
+  bool hasRateControl() const override { return true; }
+  void powerDown() override { poweredDown_ = true; }
+  void powerUp() override;
+
+  uint32_t conversionPeriodUs() const override { return 1000000u / (uint32_t)rate_; }
+  uint32_t conversionTimeoutMs() const override { return conversionPeriodUs() * 2u / 1000u + 10u; }
+  int averageSamples() const override { return rate_ >= 80 ? 16 : 5; }
+
+  int readyPinCount() const override { return 0; }
+  int readyPin(int) const override { return -1; }
+
+  void setScale(float scale) override {
+    if (scale > 0.0f) scale_ = scale;
+  }
+  float scale() const override { return scale_; }
+  void setOffset(int32_t offset) override { offset_ = offset; }
+  int32_t offset() const override { return offset_; }
+
+private:
+  static constexpr int SettleSamples = 4;
+
+  float signalKg(uint32_t tMs);
+  float gaussian();
+  uint32_t nextRandom();
+
+  SimulatedAdcConfig cfg_;
+  const SimulatedLoad *loads_ = nullptr;
+  size_t loadCount_ = 0;
+  uint32_t loopMs_ = 0;
+  const int32_t *trace_ = nullptr;
+  size_t traceCount_ = 0;
+  size_t traceIndex_ = 0;
+  uint32_t rng_ = 1;
+  bool hasSpare_ = false;
+  float spare_ = 0.0f;
+  uint64_t nowUs_ = 0;
+  uint32_t conversions_ = 0;
+  float loadKg_ = 0.0f;
+  int gain_ = 128;
+  int rate_ = 10;
+  uint8_t settleRemaining_ = 0;
+  bool poweredDown_ = false;
+  int32_t offset_ = 0;
+  float scale_ = 1000.0f;
+};
+
+}  // namespace aiw
@@ -0,0 +1,98 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+namespace aiw {
+
+// Running sum, sum of squares, min and max over the last length() samples.
+// Min/max use monotonic deques of sample sequence numbers, so push() is O(1) amortized.
+template <size_t Capacity>
+class SlidingWindowStats {
+  static_assert(Capacity >= 2 && (Capacity & (Capacity - 1)) == 0, "capacity must be a power of two");
+
+public:
+  explicit SlidingWindowStats(size_t length = Capacity) { setLength(length); }
+
+  void setLength(size_t length) {
+    if (length < 1) length = 1;
+    if (length > Capacity) length = Capacity;
+    length_ = (uint32_t)length;
+    reset();
+  }
+  size_t length() const { return length_; }
+  static constexpr size_t capacity() { return Capacity; }
+
+  void reset() {
+    seq_ = 0;
+    count_ = 0;
+    sum_ = 0;
+    sumSq_ = 0;
+    minHead_ = minTail_ = 0;
+    maxHead_ = maxTail_ = 0;
+  }
+
+  void push(int32_t v) {
+    if (count_ == length_) {
+      uint32_t expired = seq_ - length_;
+      int32_t old = values_[expired & Mask];
+      sum_ -= old;
+      sumSq_ -= (int64_t)old * old;
+      if (minTail_ != minHead_ && minQ_[minHead_ & Mask] == expired) minHead_++;
+      if (maxTail_ != maxHead_ && maxQ_[maxHead_ & Mask] == expired) maxHead_++;
+    } else {
+      count_++;
+    }
+    values_[seq_ & Mask] = v;
+    sum_ += v;
+    sumSq_ += (int64_t)v * v;
+
+    while (minTail_ != minHead_ && values_[minQ_[(minTail_ - 1) & Mask] & Mask] >= v) minTail_--;
+    minQ_[minTail_++ & Mask] = seq_;
+    while (maxTail_ != maxHead_ && values_[maxQ_[(maxTail_ - 1) & Mask] & Mask] <= v) maxTail_--;
+    maxQ_[maxTail_++ & Mask] = seq_;
+    seq_++;
+  }
+
+  size_t count() const { return count_; }
+  bool full() const { return count_ == length_; }
+  bool empty() const { return count_ == 0; }
+
+  int64_t sum() const { return sum_; }
+  int64_t sumSquares() const { return sumSq_; }
+  int32_t min() const { return count_ ? values_[minQ_[minHead_ & Mask] & Mask] : 0; }
+  int32_t max() const { return count_ ? values_[maxQ_[maxHead_ & Mask] & Mask] : 0; }
+  int32_t range() const { return max() - min(); }
+  int32_t mean() const { return count_ ? (int32_t)(sum_ / (int64_t)count_) : 0; }
+
+  // Population variance in counts^2, taken around the truncated mean m so nothing is
+  // multiplied by n: n * var = sum((x - m)^2) - r^2 / n with r = sum - n * m. Exact to
+  // a count^2 for |samples| below 2^26 at Capacity 512, where sumSquares() still fits.
+  int64_t variance() const {
+    if (count_ < 2) return 0;
+    int64_t n = count_;
+    int64_t m = sum_ / n;
+    int64_t r = sum_ - m * n;
+    int64_t centered = sumSq_ - m * (sum_ + r);
+    int64_t v = (centered - r * r / n) / n;
+    return v < 0 ? 0 : v;
+  }
+
+private:
+  static constexpr uint32_t Mask = (uint32_t)Capacity - 1;
+
+  int32_t values_[Capacity];
+  uint32_t minQ_[Capacity];
+  uint32_t maxQ_[Capacity];
+  uint32_t length_ = Capacity;
+  uint32_t seq_ = 0;
+  uint32_t count_ = 0;
+  uint32_t minHead_ = 0;
+  uint32_t minTail_ = 0;
+  uint32_t maxHead_ = 0;
+  uint32_t maxTail_ = 0;
+  int64_t sum_ = 0;
+  int64_t sumSq_ = 0;
+};
+
+}  // namespace aiw
@@ -0,0 +1,164 @@
+#pragma once
+
+#include <math.h>
+#include <stddef.h>
+#include <stdint.h>
+
+namespace aiw {
+
+struct SwayEstimate {
+  int32_t mean;
+  int32_t amplitude;
+  int32_t bound;
+  float frequencyHz;
+  bool periodic;
+  bool confident;
+};
+
+// Detects body sway in the 0.5-3 Hz band and reports the mean over whole sway periods,
+// which cancels the oscillation. Each push scans the band with Goertzel bins over the
+// last windowSeconds of samples; the sway is "periodic" when the strongest bin holds at
+// least half of the window's AC energy. The estimate is confident once the period means
+// over the last sway period agree within toleranceCounts.
+class SwayEstimator {
+public:
+  static constexpr int Capacity = 64;
+  static constexpr int MaxMeans = 32;
+  static constexpr int MaxBins = 26;
+
+  void configure(float sampleRateHz, int32_t toleranceCounts, float windowSeconds = 4.0f) {
+    if (sampleRateHz < 1.0f) sampleRateHz = 1.0f;
+    if (toleranceCounts < 1) toleranceCounts = 1;
+    fs_ = sampleRateHz;
+    tolerance_ = toleranceCounts;
+    int n = (int)(windowSeconds * fs_ + 0.5f);
+    if (n < 8) n = 8;
+    if (n > Capacity) n = Capacity;
+    length_ = n;
+    // At least one and a half periods must fit in the window.
+    float minHz = 1.5f * fs_ / (float)n > MinHz ? 1.5f * fs_ / (float)n : MinHz;
+    float maxHz = fs_ * 0.45f < MaxHz ? fs_ * 0.45f : MaxHz;
+    bins_ = 0;
+    for (float hz = minHz; hz <= maxHz + 1e-3f && bins_ < MaxBins; hz += StepHz) {
+      binHz_[bins_] = hz;
+      binCoeff_[bins_] = 2.0f * cosf(2.0f * (float)M_PI * hz / fs_);
+      bins_++;
+    }
+    reset();
+  }
+  float sampleRateHz() const { return fs_; }
+  int length() const { return length_; }
+
+  void reset() {
+    count_ = 0;
+    head_ = 0;
+    means_ = 0;
+    last_ = SwayEstimate{};
+  }
+
+  const SwayEstimate &push(int32_t x) {
+    samples_[head_] = x;
+    head_ = (head_ + 1) % Capacity;
+    if (count_ < length_) count_++;
+
+    SwayEstimate est{};
+    if (count_ >= length_ && detect(est)) {
+      meanHistory_[means_ % MaxMeans] = est.mean;
+      means_++;
+      int span = (int)(fs_ / est.frequencyHz + 0.5f);
+      if (span < 3) span = 3;
+      if (span > MaxMeans) span = MaxMeans;
+      if (means_ >= (uint32_t)span) {
+        int32_t lo = est.mean;
+        int32_t hi = est.mean;
+        for (int i = 0; i < span; ++i) {
+          int32_t m = meanHistory_[(means_ - 1 - i) % MaxMeans];
+          if (m < lo) lo = m;
+          if (m > hi) hi = m;
+        }
+        est.bound = hi - lo;
+        est.confident = est.bound <= tolerance_;
+      }
+    } else {
+      means_ = 0;
+    }
+    last_ = est;
+    return last_;
+  }
+
+  const SwayEstimate &estimate() const { return last_; }
+
+private:
+  static constexpr float MinHz = 0.5f;
+  static constexpr float MaxHz = 3.0f;
+  static constexpr float StepHz = 0.1f;
+
+  // Oldest-first access to the window.
+  int32_t at(int i) const { return samples_[(head_ + Capacity - count_ + i) % Capacity]; }
+
+  bool detect(SwayEstimate &est) const {
+    int n = count_;
+    int64_t sum = 0;
+    for (int i = 0; i < n; ++i) sum += at(i);
+    int32_t base = (int32_t)(sum / n);
+    float centered[Capacity];
+    float energy = 0.0f;
+    for (int i = 0; i < n; ++i) {
+      centered[i] = (float)(at(i) - base);
+      energy += centered[i] * centered[i];
+    }
+    if (energy <= 0.0f) return false;
+
+    float bestPower = 0.0f;
+    float bestHz = 0.0f;
+    for (int b = 0; b < bins_; ++b) {
+      float coeff = binCoeff_[b];
+      float s1 = 0.0f;
+      float s2 = 0.0f;
+      for (int i = 0; i < n; ++i) {
+        float s0 = centered[i] + coeff * s1 - s2;
+        s2 = s1;
+        s1 = s0;
+      }
+      float power = s1 * s1 + s2 * s2 - coeff * s1 * s2;
+      if (power > bestPower) {
+        bestPower = power;
+        bestHz = binHz_[b];
+      }
+    }
+    if (bestHz <= 0.0f) return false;
+    // A pure tone over the window gives power ~= energy * n / 2.
+    float ratio = 2.0f * bestPower / (energy * (float)n);
+    if (ratio < 0.5f) return false;
+
+    // Average over as many whole periods as fit, weighting the fractional last sample.
+    float period = fs_ / bestHz;
+    float span = period * floorf((float)n / period);
+    int whole = (int)span;
+    float frac = span - (float)whole;
+    float acc = 0.0f;
+    for (int i = 0; i < whole; ++i) acc += centered[n - 1 - i];
+    if (frac > 0.0f && whole < n) acc += frac * centered[n - 1 - whole];
+
+    est.periodic = true;
+    est.frequencyHz = bestHz;
+    est.mean = base + (int32_t)lroundf(acc / span);
+    est.amplitude = (int32_t)(2.0f * sqrtf(bestPower) / (float)n);
+    return true;
+  }
+
+  float fs_ = 10.0f;
+  int32_t tolerance_ = 50;
+  int length_ = 40;
+  int bins_ = 0;
+  float binHz_[MaxBins] = {0};
+  float binCoeff_[MaxBins] = {0};
+  int32_t samples_[Capacity] = {0};
+  int count_ = 0;
+  int head_ = 0;
+  uint32_t means_ = 0;
+  int32_t meanHistory_[MaxMeans] = {0};
+  SwayEstimate last_{};
+};
+
+}  // namespace aiw
@@ -0,0 +1,79 @@
+#include "app/text_draw.h"
+
+#include "app/display_st7789.h"
+#include "app/mini_font.h"
+#include "app/zh_bitmaps.h"
+#include "app/zh_font_gb1_28_subset.h"
+
+namespace aiw {
+
+void drawText5x7(DisplaySt7789 &display, int x, int y, const char *text, uint16_t fg, uint16_t bg, int scale) {
+  if (!text) return;
+  if (scale < 1) scale = 1;
+  int cx = x;
+  uint8_t rows[7];
+  while (*text) {
+    char c = *text++;
+    if (!glyph5x7(c, rows)) {
+      for (int i = 0; i < 7; ++i) rows[i] = 0;
+    }
+    // Glyph columns sit in bits 4..0; shift them up to MSB-first.
+    for (int r = 0; r < 7; ++r) rows[r] = (uint8_t)(rows[r] << 3);
+    display.blit1bpp(cx, y, 5, 7, rows, 1, fg, bg, scale);
+    cx += (6 * scale);
+  }
+}
+
+// Mode bit 0 swaps the two bytes of a row, bit 1 reads bits LSB first.
+static void drawGlyph16(DisplaySt7789 &display, int x, int y, const uint8_t *rows, uint16_t fg, uint16_t bg) {
+  uint8_t swapped[32];
+  if (zhRenderMode() & 0x01u) {
+    for (int r = 0; r < 16; ++r) {
+      swapped[r * 2 + 0] = rows[r * 2 + 1];
+      swapped[r * 2 + 1] = rows[r * 2 + 0];
+    }
+    rows = swapped;
+  }
+  display.blit1bpp(x, y, 16, 16, rows, 2, fg, bg, 1, (zhRenderMode() & 0x02u) != 0);
+}
+
+void drawZhText16(DisplaySt7789 &display, int x, int y, const char *utf8, uint16_t fg, uint16_t bg) {
+  if (!utf8) return;
+  size_t i = 0;
+  int cx = x;
+  while (true) {
+    uint32_t cp = 0;
+    if (!utf8Next(utf8, i, cp)) break;
+    const MonoGlyph16 *g = findZhGlyph(cp);
+    if (g) {
+      drawGlyph16(display, cx, y, g->rows, fg, bg);
+      cx += 16;
+    } else {
+      cx += 8;
+    }
+  }
+}
+
+// Coverage below 4/15 stays background, so the glyphs keep their hard edges.
+static void drawGlyph28Bpp4(DisplaySt7789 &display, int x, int y, const ZhGlyph28 &g, uint16_t fg, uint16_t bg) {
+  uint16_t palette[16];
+  for (int v = 0; v < 16; ++v) palette[v] = v >= 4 ? fg : bg;
+  display.blit4bpp(x, y, g.box_w, g.box_h, g.data, palette);
+}
+
+void drawZhText28(DisplaySt7789 &display, int x, int y, const char *utf8, uint16_t fg, uint16_t bg) {
+  if (!utf8) return;
+  size_t i = 0;
+  int cx = x;
+  while (true) {
+    uint32_t cp = 0;
+    if (!utf8Next(utf8, i, cp)) break;
+    const ZhGlyph28 *g = findZhGlyph28(cp);
+    if (g) {
+      drawGlyph28Bpp4(display, cx, y, *g, fg, bg);
+    }
+    cx += 28;
+  }
+}
+
+}  // namespace aiw
@@ -0,0 +1,13 @@
+#pragma once
+
+#include <stdint.h>
+
+namespace aiw {
+
+class DisplaySt7789;
+
+void drawText5x7(DisplaySt7789 &display, int x, int y, const char *text, uint16_t fg, uint16_t bg, int scale = 1);
+void drawZhText16(DisplaySt7789 &display, int x, int y, const char *utf8, uint16_t fg, uint16_t bg);
+void drawZhText28(DisplaySt7789 &display, int x, int y, const char *utf8, uint16_t fg, uint16_t bg);
+
+}  // namespace aiw
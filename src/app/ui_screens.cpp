@@ -0,0 +1,148 @@
+#include "app/ui_screens.h"
+
+#include <string.h>
+
+#include "app/zh_bitmaps.h"
+
+namespace aiw {
+namespace ui {
+
+void addButton(DisplayList &list, int x, int y, int w, int h, uint16_t bg, const char *label) {
+  int r = 10;
+  uint16_t border = 0x7BEF;
+  list.roundRect(x, y, w, h, r, border);
+  if (w > 4 && h > 4) {
+    list.roundRect(x + 2, y + 2, w - 4, h - 4, r - 2, bg);
+    list.rect(x + 4, y + 4, w - 8, 2, 0xFFFF);
+    list.rect(x + 4, y + h - 6, w - 8, 2, 0xAD55);
+  }
+  if (label && label[0]) {
+    bool hasNonAscii = false;
+    for (const char *p = label; *p; ++p) {
+      if ((uint8_t)(*p) >= 0x80u) {
+        hasNonAscii = true;
+        break;
+      }
+    }
+    if (hasNonAscii) {
+      size_t i = 0;
+      int chars = 0;
+      uint32_t cp = 0;
+      while (utf8Next(label, i, cp)) chars++;
+      int tw = chars * 16;
+      int tx = x + (w - tw) / 2;
+      int ty = y + (h - 16) / 2;
+      uint8_t prevMode = zhRenderMode();
+      setZhRenderMode(0);
+      list.zhText16(tx, ty, label, ColorBlack, bg);
+      setZhRenderMode(prevMode);
+    } else {
+      int len = (int)strlen(label);
+      int scale = 2;
+      int tw = len * 6 * scale;
+      int tx = x + (w - tw) / 2;
+      int ty = y + (h - 7 * scale) / 2;
+      list.text5x7(tx, ty, label, ColorBlack, bg, scale);
+    }
+  }
+}
+
+void addWeighFooter(DisplayList &list) {
+  addButton(list, WeighTareX, WeighBtnY, WeighTareW, WeighBtnH, 0xE7FF, kZhTare);
+  addButton(list, WeighBackX, WeighBtnY, WeighBackW, WeighBtnH, 0xF7DE, kZhBack);
+}
+
+void addPayFooter(DisplayList &list) {
+  addButton(list, PayCancelX, PayCancelY, PayCancelW, PayCancelH, 0xF7DE, kZhCancel);
+}
+
+ScreenRect sliderKnob(const SliderSpec &spec, int value) {
+  if (value < spec.min) value = spec.min;
+  if (value > spec.max) value = spec.max;
+  int range = spec.max > spec.min ? spec.max - spec.min : 1;
+  int x = spec.x + (value - spec.min) * (spec.w - 14) / range;
+  return {(int16_t)x, (int16_t)(spec.y - 4), 14, (int16_t)(spec.h + 8)};
+}
+
+void addSlider(DisplayList &list, const SliderSpec &spec, int value) {
+  list.rect(spec.x, spec.y, spec.w, spec.h, 0xEF7D);
+  list.rect(spec.x, spec.y + spec.h - 2, spec.w, 2, 0xC618);
+  list.rect(spec.x, spec.y, spec.w, 2, 0xFFFF);
+  list.text5x7(spec.x - 2, spec.y - 12, spec.minLabel, ColorGray, ColorWhite, 2);
+  list.text5x7(spec.x + spec.w - 2 - (int)strlen(spec.maxLabel) * 12, spec.y - 12, spec.maxLabel, ColorGray, ColorWhite, 2);
+  ScreenRect k = sliderKnob(spec, value);
+  list.roundRect(k.x, k.y, k.w, k.h, 6, 0x5ACB);
+  list.roundRect(k.x + 2, k.y + 2, k.w - 4, k.h - 4, 5, 0xE7FF);
+}
+
+static void addBorder(DisplayList &list) {
+  list.rect(0, 0, ScreenW, 2, ColorBlack);
+  list.rect(0, 0, 2, ScreenH, ColorBlack);
+  list.rect(ScreenW - 2, 0, 2, ScreenH, ColorBlack);
+  list.rect(0, ScreenH - 2, ScreenW, 2, ColorBlack);
+}
+
+// Border, header separator and the divider between the height and weight readouts.
+static void addFrame(DisplayList &list) {
+  addBorder(list);
+  list.rect(0, HeaderH, ScreenW, 1, ColorGray);
+  list.rect(80, 6, 1, HeaderH - 12, ColorGray);
+}
+
+void addScreenLayer(ScreenLayer layer, DisplayList &list) {
+  switch (layer) {
+    case ScreenLayer::HeightPicker:
+      addBorder(list);
+      list.zhText28(12, 8, kZhSelectHeight, ColorBlack, ColorWhite);
+      list.rect(0, 40, ScreenW, 1, ColorGray);
+      addButton(list, HeightLeftX, HeightBtnY, HeightLeftW, HeightBtnH, 0xF7DE, "<");
+      addButton(list, HeightNextX, HeightBtnY, HeightNextW, HeightBtnH, 0xE7FF, kZhNext);
+      addButton(list, HeightRightX, HeightBtnY, HeightRightW, HeightBtnH, 0xF7DE, ">");
+      return;
+    case ScreenLayer::Weigh:
+      addFrame(list);
+      addWeighFooter(list);
+      return;
+    case ScreenLayer::Pay:
+      addFrame(list);
+      list.zhText28(12, 8, kZhScanPay, ColorBlack, ColorWhite);
+      addPayFooter(list);
+      return;
+    case ScreenLayer::Frame:
+      addFrame(list);
+      return;
+  }
+}
+
+size_t screenLayerRects(ScreenLayer layer, ScreenRect *out, size_t max) {
+  static const ScreenRect full[] = {{0, 0, ScreenW, ScreenH}};
+  // The value band is redrawn live on every height change, so it is left out.
+  static const ScreenRect height[] = {
+      {0, 0, ScreenW, HeightValueY},
+      {0, HeightValueY, HeightValueX, HeightValueH},
+      {HeightValueX + HeightValueW, HeightValueY, ScreenW - HeightValueX - HeightValueW, HeightValueH},
+      {0, HeightBtnY, ScreenW, ScreenH - HeightBtnY},
+  };
+  const ScreenRect *rects = layer == ScreenLayer::HeightPicker ? height : full;
+  size_t n = layer == ScreenLayer::HeightPicker ? sizeof(height) / sizeof(height[0]) : 1;
+  if (n > max) n = max;
+  for (size_t i = 0; i < n; ++i) out[i] = rects[i];
+  return n;
+}
+
+const char *screenLayerName(ScreenLayer layer) {
+  switch (layer) {
+    case ScreenLayer::HeightPicker:
+      return "height";
+    case ScreenLayer::Weigh:
+      return "weigh";
+    case ScreenLayer::Pay:
+      return "pay";
+    case ScreenLayer::Frame:
+      return "frame";
+  }
+  return "?";
+}
+
+}  // namespace ui
+}  // namespace aiw
@@ -0,0 +1,127 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "app/display_list.h"
+#include "app/rle_image.h"
+
+namespace aiw {
+namespace ui {
+
+// Layout shared by the firmware and the host snapshot generator.
+static constexpr int ScreenW = 320;
+static constexpr int ScreenH = 240;
+
+static constexpr uint16_t ColorWhite = 0xFFFF;
+static constexpr uint16_t ColorBlack = 0x0000;
+static constexpr uint16_t ColorRed = 0xF800;
+static constexpr uint16_t ColorBlue = 0x001F;
+static constexpr uint16_t ColorGreen = 0x07E0;
+static constexpr uint16_t ColorGray = 0xC618;
+
+static const char kZhSelectHeight[] = "\xE9\x80\x89\xE6\x8B\xA9\xE8\xBA\xAB\xE9\xAB\x98";
+static const char kZhScanPay[] = "\xE6\x89\xAB\xE7\xA0\x81\xE6\x94\xAF\xE4\xBB\x98";
+static const char kZhTare[] = "去皮";
+static const char kZhBack[] = "返回";
+static const char kZhCancel[] = "取消";
+static const char kZhNext[] = "下一步";
+
+static constexpr int HeaderH = 66;
+static constexpr int FooterH = 44;
+static constexpr int FooterY = ScreenH - FooterH - 4;
+
+static constexpr int HeightSliderX = 30;
+static constexpr int HeightSliderY = 132;
+static constexpr int HeightSliderW = 260;
+static constexpr int HeightSliderH = 26;
+
+static constexpr int HeightBtnY = 164;
+static constexpr int HeightBtnH = 68;
+static constexpr int HeightLeftX = 14;
+static constexpr int HeightLeftW = 86;
+static constexpr int HeightNextX = 108;
+static constexpr int HeightNextW = 104;
+static constexpr int HeightRightX = 220;
+static constexpr int HeightRightW = 86;
+
+// Height value, slider and knob overhang: everything between the title separator and
+// the buttons, inside the border margin.
+static constexpr int HeightValueX = 4;
+static constexpr int HeightValueY = 41;
+static constexpr int HeightValueW = ScreenW - 8;
+static constexpr int HeightValueH = HeightBtnY - HeightValueY;
+
+static constexpr int WeighBtnY = FooterY;
+static constexpr int WeighBtnH = FooterH;
+static constexpr int WeighTareX = 10;
+static constexpr int WeighTareW = 120;
+static constexpr int WeighBackX = 190;
+static constexpr int WeighBackW = 120;
+
+static constexpr int PayCancelX = 90;
+static constexpr int PayCancelY = FooterY;
+static constexpr int PayCancelW = 140;
+static constexpr int PayCancelH = FooterH;
+
+// Gap around the QR code, between the header and the footer.
+static constexpr int QrMargin = 6;
+
+// Header label of the status screens.
+static constexpr int StatusLabelX = 10;
+static constexpr int StatusLabelY = 46;
+
+struct ScreenRect {
+  int16_t x;
+  int16_t y;
+  int16_t w;
+  int16_t h;
+};
+
+struct SliderSpec {
+  int x;
+  int y;
+  int w;
+  int h;
+  int min;
+  int max;
+  const char *minLabel;
+  const char *maxLabel;
+};
+
+static constexpr SliderSpec HeightSlider = {HeightSliderX, HeightSliderY, HeightSliderW, HeightSliderH, 120, 220, "120", "220"};
+
+void addButton(DisplayList &list, int x, int y, int w, int h, uint16_t bg, const char *label);
+void addWeighFooter(DisplayList &list);
+void addPayFooter(DisplayList &list);
+// Track, end labels and knob; the knob overhangs the track by 4 px above and below.
+void addSlider(DisplayList &list, const SliderSpec &spec, int value);
+ScreenRect sliderKnob(const SliderSpec &spec, int value);
+
+enum class ScreenLayer : uint8_t {
+  HeightPicker = 0,
+  Weigh = 1,
+  Pay = 2,
+  Frame = 3,
+};
+static constexpr int ScreenLayerCount = 4;
+
+// Static part of a screen, i.e. what the screen looks like before anything dynamic is
+// drawn on top: the height picker without its value band, the weighing frame and
+// footer, the pay frame, header and footer, the bare frame of the status screens.
+// Adds ops only; the caller picks the region, on a white background.
+void addScreenLayer(ScreenLayer layer, DisplayList &list);
+// The parts of the layer kept in its snapshot; the rest is always drawn live.
+size_t screenLayerRects(ScreenLayer layer, ScreenRect *out, size_t max);
+const char *screenLayerName(ScreenLayer layer);
+
+struct ScreenSnapshot {
+  const RleImage *pieces;
+  uint8_t count;
+};
+
+// Generated by tools/screen_snapshots.cpp into screen_snapshots_data.cpp.
+const ScreenSnapshot &screenSnapshot(ScreenLayer layer);
+
+}  // namespace ui
+}  // namespace aiw
@@ -0,0 +1,125 @@
+#pragma once
+
+#include <stddef.h>
+#include <math.h>
+#include <stdint.h>
+
+#include "app/noise_floor.h"
+#include "app/weight_filter.h"
+
+namespace aiw {
+
+// Loop tuning shared by the firmware and the host replay/simulation tools, in raw counts.
+static constexpr size_t StableWindowCapacity = 512;
+static constexpr int32_t ZeroSnapDelta = 200;
+static constexpr int32_t PayTriggerDelta = 800;
+static constexpr int32_t GlitchDelta = 2000;
+// Boot tare: motion limit in display steps, and the collections allowed before giving up.
+static constexpr int TareMotionSteps = 2;
+static constexpr uint8_t TareMaxAttempts = 5;
+
+class SampleAverager {
+public:
+  explicit SampleAverager(int count = 3) { setCount(count); }
+
+  void setCount(int count) {
+    count_ = count < 1 ? 1 : count;
+    reset();
+  }
+  int count() const { return count_; }
+
+  void reset() {
+    sum_ = 0;
+    n_ = 0;
+  }
+
+  bool push(int32_t raw, int32_t &avgOut) {
+    sum_ += raw;
+    n_++;
+    if (n_ < count_) return false;
+    avgOut = (int32_t)(sum_ / n_);
+    reset();
+    return true;
+  }
+
+private:
+  int count_ = 3;
+  int64_t sum_ = 0;
+  int n_ = 0;
+};
+
+class PayTrigger {
+public:
+  void configure(int32_t minCounts, uint32_t holdMs) {
+    minCounts_ = minCounts;
+    holdMs_ = holdMs;
+    reset();
+  }
+
+  void reset() { holding_ = false; }
+  bool holding() const { return holding_; }
+
+  bool update(const FilterOutput &fo, uint32_t nowMs) {
+    if (!fo.stable) {
+      holding_ = false;
+      return false;
+    }
+    // A lock on the settling estimate can show zero while the EMA still decays after a
+    // step-off, so the shown weight must be non-zero too.
+    int32_t absFiltered = fo.filtered < 0 ? -fo.filtered : fo.filtered;
+    if (absFiltered < minCounts_ || fo.display == 0) {
+      holding_ = false;
+      return false;
+    }
+    if (!holding_) {
+      holding_ = true;
+      holdStartMs_ = nowMs;
+    }
+    if (nowMs - holdStartMs_ < holdMs_) return false;
+    holding_ = false;
+    return true;
+  }
+
+private:
+  int32_t minCounts_ = 800;
+  uint32_t holdMs_ = 900;
+  bool holding_ = false;
+  uint32_t holdStartMs_ = 0;
+};
+
+// Thresholds before the noise floor is known: the fixed loop deltas and the filter's
+// default stability band.
+inline NoiseThresholds fallbackNoiseThresholds() {
+  WeightFilterConfig def;
+  return NoiseThresholds{ZeroSnapDelta, def.stableBaseCounts, def.stableMaxCounts, PayTriggerDelta, GlitchDelta};
+}
+
+// averageSamples converts the raw-conversion sigma to that of one filter input.
+inline NoiseThresholds currentNoiseThresholds(const NoiseFloorEstimator &nf, int averageSamples, float countsPerKg, float stepKg) {
+  if (!nf.ready()) return fallbackNoiseThresholds();
+  return deriveNoiseThresholds(nf.sigma() / sqrtf((float)averageSamples), countsPerKg, stepKg);
+}
+
+// Retuning is worth a filter reconfigure only when some threshold moves by over 10%.
+inline bool noiseThresholdsDiffer(const NoiseThresholds &a, const NoiseThresholds &b) {
+  auto differ = [](int32_t x, int32_t y) {
+    int32_t d = x > y ? x - y : y - x;
+    return d * 10 > (x > y ? x : y);
+  };
+  return differ(a.zeroSnapCounts, b.zeroSnapCounts) || differ(a.stableBaseCounts, b.stableBaseCounts) || differ(a.stableMaxCounts, b.stableMaxCounts) || differ(a.payTriggerCounts, b.payTriggerCounts) || differ(a.glitchCounts, b.glitchCounts);
+}
+
+inline void applyFilterThresholds(WeightFilterConfig &cfg, const NoiseThresholds &th) {
+  cfg.zeroSnapCounts = th.zeroSnapCounts;
+  cfg.glitchCounts = th.glitchCounts;
+  cfg.stableBaseCounts = th.stableBaseCounts;
+  cfg.stableMaxCounts = th.stableMaxCounts;
+}
+
+// The estimator only accepts windows well below the pay trigger as empty-platform noise.
+inline void applyTriggerThresholds(const NoiseThresholds &th, uint32_t holdMs, PayTrigger &trigger, NoiseFloorEstimator &nf) {
+  trigger.configure(th.payTriggerCounts, holdMs);
+  nf.setBand(th.payTriggerCounts / 2);
+}
+
+}  // namespace aiw
@@ -0,0 +1,46 @@
+#include "app/weigh_profile.h"
+
+#include <string.h>
+
+namespace aiw {
+
+static const WeighProfile Profiles[WeighProfileCount] = {
+  // Person: short averaging, fast EMA, 100 g steps and the sway/step estimators so a
+  // swaying user still locks within about a second.
+  {"person", 0, 3, 8, 2, 6, 0.1f, 0.15f, 0.3f, 1, 900, true, true},
+  // Precision: parcels and produce sit still, so trade latency for 10 g steps: 10 sps
+  // for the HX711's mains rejection, deeper averaging, more stable hits and a longer
+  // hold. Nothing sways, so only the step predictor runs.
+  {"precision", 10, 4, 16, 2, 8, 0.01f, 0.015f, 0.03f, 2, 1200, true, false},
+};
+
+const WeighProfile &weighProfile(WeighProfileId id) {
+  uint8_t i = (uint8_t)id;
+  return Profiles[i < WeighProfileCount ? i : 0];
+}
+
+bool weighProfileFromName(const char *name, WeighProfileId &id) {
+  for (int i = 0; i < WeighProfileCount; ++i) {
+    if (strcmp(name, Profiles[i].name) == 0) {
+      id = (WeighProfileId)i;
+      return true;
+    }
+  }
+  return false;
+}
+
+int weighProfileAverage(const WeighProfile &p, int rateSps) {
+  return rateSps >= 80 ? p.average80Sps : p.average10Sps;
+}
+
+WeightFilterConfig makeWeighProfileConfig(const WeighProfile &p, float countsPerKg, int rateSps) {
+  WeightFilterConfig cfg = makeWeightFilterConfig(countsPerKg, p.stepKg, p.hysteresisKg, p.unlockKg);
+  cfg.emaShift = p.emaShift;
+  cfg.stableHitsToLock = p.stableHitsToLock;
+  cfg.predictSettling = p.predictSettling;
+  cfg.swayDetect = p.swayDetect;
+  cfg.sampleRateHz = (float)rateSps / (float)weighProfileAverage(p, rateSps);
+  return cfg;
+}
+
+}  // namespace aiw
@@ -0,0 +1,41 @@
+#pragma once
+
+#include <stdint.h>
+
+#include "app/weight_filter.h"
+
+namespace aiw {
+
+enum class WeighProfileId : uint8_t { Person = 0, Precision = 1 };
+
+// Everything that trades latency against resolution on the weighing path. Counts-based
+// thresholds still come from the noise floor; they are derived against stepKg.
+struct WeighProfile {
+  const char *name;
+  // HX711 rate when the RATE pin is wired; 0 keeps the configured rate.
+  uint8_t rateSps;
+  // Conversions averaged per filter input at 10 and 80 sps.
+  uint8_t average10Sps;
+  uint8_t average80Sps;
+  uint8_t emaShift;
+  uint8_t stableHitsToLock;
+  float stepKg;
+  float hysteresisKg;
+  float unlockKg;
+  uint8_t decimals;
+  uint32_t holdMs;
+  bool predictSettling;
+  bool swayDetect;
+};
+
+static constexpr int WeighProfileCount = 2;
+
+const WeighProfile &weighProfile(WeighProfileId id);
+// Returns false and leaves id untouched for an unknown name.
+bool weighProfileFromName(const char *name, WeighProfileId &id);
+int weighProfileAverage(const WeighProfile &p, int rateSps);
+
+// Filter config for the profile; counts thresholds keep their defaults.
+WeightFilterConfig makeWeighProfileConfig(const WeighProfile &p, float countsPerKg, int rateSps);
+
+}  // namespace aiw
@@ -0,0 +1,249 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "app/hampel_filter.h"
+#include "app/settling_predictor.h"
+#include "app/sliding_window.h"
+#include "app/sway_estimator.h"
+
+namespace aiw {
+
+enum class StabilityMode : uint8_t { Slope = 0, Window = 1 };
+
+struct WeightFilterConfig {
+  int32_t zeroSnapCounts = 200;
+  // Hampel prefilter: jumps beyond max(glitchCounts, spikeSigmas * sigma) are held for one sample.
+  // spikeWindow 0 sizes the history to ~1.5 s so a full sway period widens the MAD.
+  int32_t glitchCounts = 2000;
+  uint8_t spikeWindow = 0;
+  uint8_t spikeSigmas = 3;
+  int32_t stableBaseCounts = 120;
+  int32_t stableSlopeDivisor = 500;
+  int32_t stableMaxCounts = 500;
+  uint8_t stableHitsToLock = 6;
+  uint8_t emaShift = 2;
+  // Display step and the hysteresis/unlock bands are Q8: counts * 256 and steps * 256.
+  int32_t stepCountsQ8 = 100 * 256;
+  int32_t hysteresisStepsQ8 = 384;
+  int32_t unlockStepsQ8 = 768;
+  // Window mode: stable once the last stableWindow raw deltas span no more than the threshold.
+  StabilityMode stabilityMode = StabilityMode::Slope;
+  uint16_t stableWindow = 6;
+  // Lock early on a confident step-response extrapolation, or on the period-averaged
+  // mean of a periodic sway. Both estimates must agree within estimateToleranceQ8 steps.
+  bool predictSettling = false;
+  bool swayDetect = false;
+  float sampleRateHz = 10.0f;
+  int32_t estimateToleranceQ8 = 256;
+};
+
+inline WeightFilterConfig makeWeightFilterConfig(float countsPerKg, float stepKg, float hysteresisKg, float unlockKg) {
+  WeightFilterConfig cfg;
+  if (countsPerKg <= 0.0f || stepKg <= 0.0f) return cfg;
+  float stepCounts = countsPerKg * stepKg;
+  if (stepCounts < 1.0f) stepCounts = 1.0f;
+  cfg.stepCountsQ8 = (int32_t)(stepCounts * 256.0f + 0.5f);
+  cfg.hysteresisStepsQ8 = (int32_t)(hysteresisKg / stepKg * 256.0f + 0.5f);
+  cfg.unlockStepsQ8 = (int32_t)(unlockKg / stepKg * 256.0f + 0.5f);
+  return cfg;
+}
+
+struct FilterOutput {
+  int32_t display;
+  int32_t filtered;
+  bool stable;
+  bool locked;
+  bool glitch;
+  bool step;
+  bool predicted;
+  bool swaying;
+};
+
+template <size_t WindowCapacity = 8, int FracBits = 8>
+class WeightFilter {
+  static_assert(WindowCapacity >= 4, "stability window needs at least 4 samples");
+  static_assert(FracBits > 0 && FracBits < 24, "FracBits out of range");
+
+public:
+  explicit WeightFilter(const WeightFilterConfig &cfg = WeightFilterConfig{}) { configure(cfg); }
+
+  void configure(const WeightFilterConfig &cfg) {
+    cfg_ = cfg;
+    if (cfg_.stepCountsQ8 < 1) cfg_.stepCountsQ8 = 1;
+    if (cfg_.stableSlopeDivisor < 1) cfg_.stableSlopeDivisor = 1;
+    if (cfg_.stableWindow < 4) cfg_.stableWindow = 4;
+    if (cfg_.stableWindow > WindowCapacity) cfg_.stableWindow = (uint16_t)WindowCapacity;
+    window_.setLength(cfg_.stableWindow);
+    int spikeLength = cfg_.spikeWindow ? cfg_.spikeWindow : (int)(cfg_.sampleRateHz * 1.5f + 0.5f);
+    spike_.configure(spikeLength, cfg_.glitchCounts, cfg_.spikeSigmas);
+    int32_t tolerance = (int32_t)(((int64_t)cfg_.stepCountsQ8 * cfg_.estimateToleranceQ8) >> 16);
+    predictor_.configure(tolerance);
+    sway_.configure(cfg_.sampleRateHz, tolerance);
+  }
+  const WeightFilterConfig &config() const { return cfg_; }
+
+  void reset() {
+    resetWindow();
+    spike_.reset();
+    predictor_.reset();
+    sway_.reset();
+    filteredInit_ = false;
+    hasLastFiltered_ = false;
+  }
+
+  FilterOutput push(int32_t sample) {
+    FilterOutput out{};
+    int32_t delta = sample;
+    HampelVerdict verdict = spike_.push(sample, delta);
+    if (verdict == HampelVerdict::Held) {
+      out.glitch = true;
+    } else if (verdict == HampelVerdict::Step) {
+      // A confirmed load change: restart the EMA and stability state at the new level.
+      resetWindow();
+      predictor_.reset();
+      sway_.reset();
+      filteredInit_ = false;
+      hasLastFiltered_ = false;
+      out.step = true;
+    }
+    window_.push(delta);
+    SettlingEstimate est{};
+    if (cfg_.predictSettling) est = predictor_.push(delta);
+    SwayEstimate sway{};
+    if (cfg_.swayDetect) sway = sway_.push(delta);
+
+    int64_t x = (int64_t)delta << FracBits;
+    if (!filteredInit_) {
+      filteredQ_ = x;
+      filteredInit_ = true;
+    } else {
+      filteredQ_ += (x - filteredQ_) >> cfg_.emaShift;
+    }
+
+    int32_t filtered = (int32_t)((filteredQ_ + Half) >> FracBits);
+    int32_t absFiltered = absI32(filtered);
+    int32_t displayDelta = absFiltered < cfg_.zeroSnapCounts ? 0 : filtered;
+
+    int32_t steps = divRound((int64_t)displayDelta * 256, cfg_.stepCountsQ8);
+    if (hasLastShown_ && (int64_t)absI32(steps - lastShown_) * 256 < cfg_.hysteresisStepsQ8) {
+      steps = lastShown_;
+    }
+
+    int32_t threshold = cfg_.stableBaseCounts + absFiltered / cfg_.stableSlopeDivisor;
+    if (threshold > cfg_.stableMaxCounts) threshold = cfg_.stableMaxCounts;
+    bool stable = false;
+    if (cfg_.stabilityMode == StabilityMode::Window) {
+      stable = window_.full() && window_.range() <= threshold;
+      stableHits_ = stable ? (uint8_t)(stableHits_ < 255 ? stableHits_ + 1 : 255) : 0;
+    } else {
+      bool stableNow = hasLastFiltered_ && absI32(displayDelta - lastFiltered_) <= threshold;
+      if (stableNow) {
+        if (stableHits_ < 255) stableHits_++;
+      } else {
+        stableHits_ = 0;
+      }
+      stable = stableHits_ >= cfg_.stableHitsToLock;
+    }
+    bool predicted = false;
+    bool swaying = false;
+    int32_t estimate = 0;
+    if (!stable && est.confident) {
+      stable = true;
+      predicted = true;
+      estimate = est.value;
+    } else if (!stable && sway.confident) {
+      stable = true;
+      swaying = true;
+      estimate = sway.mean;
+    }
+    hasLastFiltered_ = true;
+    lastFiltered_ = displayDelta;
+
+    int32_t shown = steps;
+    if (stable) {
+      if (!locked_) {
+        locked_ = true;
+        lockedSteps_ = predicted || swaying ? predictedSteps(estimate) : steps;
+        lockEstimated_ = predicted || swaying;
+      } else if (!predicted && !swaying) {
+        lockEstimated_ = false;
+      }
+      shown = lockedSteps_;
+    } else if (locked_) {
+      // An estimated lock is held against the estimate while the EMA catches up or sways.
+      int32_t ref = steps;
+      if (lockEstimated_ && est.valid) {
+        ref = predictedSteps(est.value);
+      } else if (lockEstimated_ && sway.periodic) {
+        ref = predictedSteps(sway.mean);
+      }
+      if ((int64_t)absI32(ref - lockedSteps_) * 256 > cfg_.unlockStepsQ8) {
+        locked_ = false;
+      } else {
+        shown = lockedSteps_;
+      }
+    }
+    hasLastShown_ = true;
+    lastShown_ = shown;
+
+    out.display = shown;
+    out.filtered = filtered;
+    out.stable = stable;
+    out.locked = locked_;
+    out.predicted = predicted;
+    out.swaying = swaying;
+    return out;
+  }
+
+  uint32_t glitchCount() const { return spike_.spikes(); }
+  uint32_t stepCount() const { return spike_.steps(); }
+  const HampelFilter &spikeFilter() const { return spike_; }
+  const SettlingEstimate &settlingEstimate() const { return predictor_.estimate(); }
+  const SwayEstimate &swayEstimate() const { return sway_.estimate(); }
+  uint8_t stableHits() const { return stableHits_; }
+  const SlidingWindowStats<WindowCapacity> &window() const { return window_; }
+  static constexpr size_t windowCapacity() { return WindowCapacity; }
+
+private:
+  static constexpr int64_t Half = (int64_t)1 << (FracBits - 1);
+
+  static int32_t absI32(int32_t v) { return v < 0 ? -v : v; }
+
+  static int32_t divRound(int64_t num, int64_t den) {
+    if (num >= 0) return (int32_t)((num + den / 2) / den);
+    return (int32_t)(-((-num + den / 2) / den));
+  }
+
+  int32_t predictedSteps(int32_t value) const {
+    if (absI32(value) < cfg_.zeroSnapCounts) return 0;
+    return divRound((int64_t)value * 256, cfg_.stepCountsQ8);
+  }
+
+  void resetWindow() {
+    window_.reset();
+    stableHits_ = 0;
+    locked_ = false;
+    lockEstimated_ = false;
+    hasLastShown_ = false;
+  }
+
+  WeightFilterConfig cfg_;
+  SlidingWindowStats<WindowCapacity> window_;
+  HampelFilter spike_;
+  SettlingPredictor predictor_;
+  SwayEstimator sway_;
+  uint8_t stableHits_ = 0;
+  bool filteredInit_ = false;
+  int64_t filteredQ_ = 0;
+  bool hasLastFiltered_ = false;
+  int32_t lastFiltered_ = 0;
+  bool locked_ = false;
+  bool lockEstimated_ = false;
+  int32_t lockedSteps_ = 0;
+  bool hasLastShown_ = false;
+  int32_t lastShown_ = 0;
+};
+
+}  // namespace aiw
@@ -0,0 +1,248 @@
+#include "app/widgets.h"
+
+#include <string.h>
+
+namespace aiw {
+
+static bool intersect(const ui::ScreenRect &a, const ui::ScreenRect &b, ui::ScreenRect &out) {
+  int x0 = a.x > b.x ? a.x : b.x;
+  int y0 = a.y > b.y ? a.y : b.y;
+  int x1 = a.x + a.w < b.x + b.w ? a.x + a.w : b.x + b.w;
+  int y1 = a.y + a.h < b.y + b.h ? a.y + a.h : b.y + b.h;
+  if (x1 <= x0 || y1 <= y0) return false;
+  out = {(int16_t)x0, (int16_t)y0, (int16_t)(x1 - x0), (int16_t)(y1 - y0)};
+  return true;
+}
+
+Widget::Widget(int x, int y, int w, int h) : bounds_{(int16_t)x, (int16_t)y, (int16_t)w, (int16_t)h} {}
+
+bool Widget::contains(int x, int y) const {
+  return x >= bounds_.x && x < bounds_.x + bounds_.w && y >= bounds_.y && y < bounds_.y + bounds_.h;
+}
+
+void Widget::invalidate() {
+  damage(bounds_);
+  lost();
+}
+
+void Widget::invalidate(const ui::ScreenRect &r) {
+  damage(r);
+  lost();
+}
+
+// The damage is kept as one bounding box, clipped to the widget.
+void Widget::damage(const ui::ScreenRect &r) {
+  ui::ScreenRect c;
+  if (!intersect(r, bounds_, c)) return;
+  if (!dirty()) {
+    damage_ = c;
+    return;
+  }
+  int x0 = c.x < damage_.x ? c.x : damage_.x;
+  int y0 = c.y < damage_.y ? c.y : damage_.y;
+  int x1 = c.x + c.w > damage_.x + damage_.w ? c.x + c.w : damage_.x + damage_.w;
+  int y1 = c.y + c.h > damage_.y + damage_.h ? c.y + c.h : damage_.y + damage_.h;
+  damage_ = {(int16_t)x0, (int16_t)y0, (int16_t)(x1 - x0), (int16_t)(y1 - y0)};
+}
+
+void Widget::clean() {
+  damage_ = {0, 0, 0, 0};
+}
+
+LabelWidget::LabelWidget(int x, int y, int w, int h, LabelFont font, int scale, uint16_t fg, uint16_t bg)
+    : Widget(x, y, w, h), font_(font), scale_((uint8_t)(scale < 1 ? 1 : scale)), fg_(fg), bg_(bg) {}
+
+void LabelWidget::setText(const char *text) {
+  if (!text) text = "";
+  if (strncmp(text, text_, MaxText) == 0) return;
+  strncpy(text_, text, MaxText);
+  text_[MaxText] = '\0';
+  damageAll();
+}
+
+void LabelWidget::addOps(DisplayList &list) const {
+  const ui::ScreenRect &b = bounds();
+  switch (font_) {
+    case LabelFont::Mono5x7:
+      list.text5x7(b.x, b.y, text_, fg_, bg_, scale_);
+      return;
+    case LabelFont::Zh16:
+      list.zhText16(b.x, b.y, text_, fg_, bg_);
+      return;
+    case LabelFont::Zh28:
+      list.zhText28(b.x, b.y, text_, fg_, bg_);
+      return;
+  }
+}
+
+NumberWidget::NumberWidget(SevenSeg &seg, int x, int y, int maxChars, int scale, uint16_t on, uint16_t off)
+    : Widget(x, y, maxChars * 7 * scale - scale, 10 * scale), seg_(seg), scale_((uint8_t)scale), on_(on), off_(off) {}
+
+void NumberWidget::setText(const char *text) {
+  if (!text) text = "";
+  if (strncmp(text, text_, SevenSegState::MaxCells) == 0) return;
+  strncpy(text_, text, SevenSegState::MaxCells);
+  text_[SevenSegState::MaxCells] = '\0';
+  damageAll();
+}
+
+void NumberWidget::draw(DisplaySt7789 &display) {
+  const ui::ScreenRect &b = bounds();
+  if (!state_.valid) display.fillRect(b.x, b.y, b.w, b.h, off_);
+  seg_.drawTextDiff(state_, b.x, b.y, text_, scale_, on_, off_);
+}
+
+ButtonWidget::ButtonWidget(int x, int y, int w, int h, uint16_t bg, const char *label)
+    : Widget(x, y, w, h), bg_(bg), label_(label) {}
+
+ui::ScreenRect ButtonWidget::barRect() const {
+  const ui::ScreenRect &b = bounds();
+  return {(int16_t)(b.x + 4), (int16_t)(b.y + b.h - 6), (int16_t)(b.w - 8), 2};
+}
+
+void ButtonWidget::setBar(int fill, uint16_t color) {
+  int maxFill = bounds().w - 8;
+  if (fill < 0) fill = 0;
+  if (fill > maxFill) fill = maxFill;
+  if (fill == barFill_ && (fill == 0 || color == barColor_)) return;
+  barFill_ = (int16_t)fill;
+  barColor_ = color;
+  damage(barRect());
+}
+
+void ButtonWidget::addOps(DisplayList &list) const {
+  const ui::ScreenRect &b = bounds();
+  ui::addButton(list, b.x, b.y, b.w, b.h, bg_, label_);
+  if (barFill_ > 0) {
+    ui::ScreenRect bar = barRect();
+    list.rect(bar.x, bar.y, barFill_, bar.h, barColor_);
+  }
+}
+
+SliderWidget::SliderWidget(int x, int y, int w, int h, const ui::SliderSpec &spec, int value)
+    : Widget(x, y, w, h), spec_(spec), value_(value) {}
+
+void SliderWidget::setValue(int value) {
+  if (value == value_) return;
+  damage(ui::sliderKnob(spec_, value_));
+  value_ = value;
+  damage(ui::sliderKnob(spec_, value_));
+}
+
+void SliderWidget::addOps(DisplayList &list) const {
+  ui::addSlider(list, spec_, value_);
+}
+
+QrWidget::QrWidget(QrRenderer &renderer, int x, int y, int w, int h, uint16_t fg, uint16_t bg)
+    : Widget(x, y, w, h), renderer_(renderer), fg_(fg), bg_(bg) {}
+
+void QrWidget::setMatrix(const QrMatrix *matrix) {
+  matrix_ = matrix;
+  damageAll();
+}
+
+void QrWidget::draw(DisplaySt7789 &display) {
+  const ui::ScreenRect &b = bounds();
+  display.fillRect(b.x, b.y, b.w, b.h, bg_);
+  drawn_ = false;
+  if (!matrix_) return;
+  int size = b.w < b.h ? b.w : b.h;
+  drawn_ = renderer_.drawMatrix(*matrix_, b.x + (b.w - size) / 2, b.y, size, fg_, bg_);
+}
+
+ImageWidget::ImageWidget(ui::ScreenLayer layer) : Widget(0, 0, ui::ScreenW, ui::ScreenH), layer_(layer) {}
+
+void ImageWidget::blitSnapshot(DisplaySt7789 &display) const {
+  const ui::ScreenSnapshot &snap = ui::screenSnapshot(layer_);
+  for (uint8_t i = 0; i < snap.count; ++i) display.blitRle(snap.pieces[i]);
+}
+
+// One list for every screen: only one renders at a time.
+static DisplayList regionList;
+
+WidgetScreen::WidgetScreen(ImageWidget &backdrop) : backdrop_(backdrop) {}
+
+bool WidgetScreen::add(Widget &widget) {
+  if (count_ >= MaxWidgets) return false;
+  widgets_[count_++] = &widget;
+  full_ = true;
+  return true;
+}
+
+// Backdrop and list widgets under r in one pass; direct widgets there are lost.
+void WidgetScreen::renderRegion(DisplaySt7789 &display, const ui::ScreenRect &r) {
+  regionList.begin(r.x, r.y, r.w, r.h, ui::ColorWhite);
+  backdrop_.addOps(regionList);
+  ui::ScreenRect c;
+  for (int i = 0; i < count_; ++i) {
+    if (!widgets_[i]->direct() && intersect(widgets_[i]->bounds(), r, c)) widgets_[i]->addOps(regionList);
+  }
+  display.drawList(regionList);
+  for (int i = 0; i < count_; ++i) {
+    if (widgets_[i]->direct() && intersect(widgets_[i]->bounds(), r, c)) widgets_[i]->invalidate(c);
+  }
+}
+
+bool WidgetScreen::render(DisplaySt7789 &display) {
+  bool any = full_;
+  for (int i = 0; i < count_ && !any; ++i) any = widgets_[i]->dirty();
+  if (!any) return false;
+  if (fullRepaint_) full_ = true;
+
+  uint32_t t0 = micros();
+  uint32_t repainted = 0;
+  uint64_t pixels = 0;
+  bool full = full_;
+  display.beginWrite();
+  if (full) {
+    const ui::ScreenRect screen = backdrop_.bounds();
+    if (backdrop_.snapshot()) {
+      // List widgets then repaint over the snapshot below.
+      backdrop_.blitSnapshot(display);
+      for (int i = 0; i < count_; ++i) {
+        if (!widgets_[i]->direct()) widgets_[i]->damageAll();
+      }
+    } else {
+      renderRegion(display, screen);
+      for (int i = 0; i < count_; ++i) {
+        if (!widgets_[i]->direct()) widgets_[i]->clean();
+      }
+    }
+    for (int i = 0; i < count_; ++i) {
+      if (widgets_[i]->direct()) widgets_[i]->invalidate();
+    }
+    pixels += (uint64_t)screen.w * (uint64_t)screen.h;
+    stats_.fullFrames++;
+  }
+  for (int i = 0; i < count_; ++i) {
+    Widget *w = widgets_[i];
+    if (w->direct() || !w->dirty()) continue;
+    ui::ScreenRect r = w->damaged();
+    w->clean();
+    renderRegion(display, r);
+    if (!full) pixels += (uint64_t)r.w * (uint64_t)r.h;
+    repainted++;
+  }
+  for (int i = 0; i < count_; ++i) {
+    Widget *w = widgets_[i];
+    if (!w->direct() || !w->dirty()) continue;
+    if (!full) pixels += (uint64_t)w->damaged().w * (uint64_t)w->damaged().h;
+    w->draw(display);
+    w->clean();
+    repainted++;
+  }
+  display.endWrite();
+  display.flush();
+  full_ = false;
+
+  uint32_t us = micros() - t0;
+  stats_.frames++;
+  stats_.widgets += repainted;
+  stats_.pixels += pixels;
+  stats_.lastUs = us;
+  if (us > stats_.maxUs) stats_.maxUs = us;
+  stats_.totalUs += us;
+  return true;
+}
+
+}  // namespace aiw
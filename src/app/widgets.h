@@ -0,0 +1,196 @@
+#pragma once
+
+#include <Arduino.h>
+
+#include "app/display_list.h"
+#include "app/display_st7789.h"
+#include "app/qr_client.h"
+#include "app/qr_renderer.h"
+#include "app/seven_seg.h"
+#include "app/ui_screens.h"
+
+namespace aiw {
+
+// A retained UI element with a fixed screen rectangle. Setters damage only the part
+// that changed; WidgetScreen::render() repaints the damage and nothing else.
+class Widget {
+public:
+  Widget(int x, int y, int w, int h);
+  virtual ~Widget() = default;
+
+  const ui::ScreenRect &bounds() const { return bounds_; }
+  const ui::ScreenRect &damaged() const { return damage_; }
+  bool dirty() const { return damage_.w > 0 && damage_.h > 0; }
+  bool contains(int x, int y) const;
+  // Something else drew over (part of) the widget.
+  void invalidate();
+  void invalidate(const ui::ScreenRect &r);
+
+  // List widgets add display list ops, rasterized in one pass with the backdrop and
+  // every other list widget under the damaged rectangle.
+  virtual bool direct() const { return false; }
+  virtual void addOps(DisplayList &list) const { (void)list; }
+  // Direct widgets draw their own damage, after the list widgets.
+  virtual void draw(DisplaySt7789 &display) { (void)display; }
+
+protected:
+  void damage(const ui::ScreenRect &r);
+  void damageAll() { damage(bounds_); }
+  // Called by invalidate(): incremental state no longer matches the panel.
+  virtual void lost() {}
+
+private:
+  friend class WidgetScreen;
+  void clean();
+
+  ui::ScreenRect bounds_;
+  ui::ScreenRect damage_{0, 0, 0, 0};
+};
+
+enum class LabelFont : uint8_t {
+  Mono5x7 = 0,
+  Zh16 = 1,
+  Zh28 = 2,
+};
+
+class LabelWidget : public Widget {
+public:
+  static constexpr size_t MaxText = 31;
+
+  // Text is drawn at the top-left corner; the rest of the box shows the backdrop.
+  LabelWidget(int x, int y, int w, int h, LabelFont font, int scale, uint16_t fg, uint16_t bg);
+  void setText(const char *text);
+  const char *text() const { return text_; }
+  void addOps(DisplayList &list) const override;
+
+private:
+  LabelFont font_;
+  uint8_t scale_;
+  uint16_t fg_;
+  uint16_t bg_;
+  char text_[MaxText + 1] = "";
+};
+
+// Seven-segment readout repainted segment by segment (SevenSeg::drawTextDiff).
+class NumberWidget : public Widget {
+public:
+  NumberWidget(SevenSeg &seg, int x, int y, int maxChars, int scale, uint16_t on, uint16_t off);
+  void setText(const char *text);
+  bool direct() const override { return true; }
+  void draw(DisplaySt7789 &display) override;
+
+protected:
+  void lost() override { state_.invalidate(); }
+
+private:
+  SevenSeg &seg_;
+  uint8_t scale_;
+  uint16_t on_;
+  uint16_t off_;
+  char text_[SevenSegState::MaxCells + 1] = "";
+  SevenSegState state_;
+};
+
+class ButtonWidget : public Widget {
+public:
+  ButtonWidget(int x, int y, int w, int h, uint16_t bg, const char *label);
+  // Progress line over the bottom shade: fill pixels in color, the rest unchanged.
+  void setBar(int fill, uint16_t color);
+  void addOps(DisplayList &list) const override;
+
+private:
+  ui::ScreenRect barRect() const;
+
+  uint16_t bg_;
+  const char *label_;
+  int16_t barFill_ = 0;
+  uint16_t barColor_ = 0;
+};
+
+// Bounds must hold the track, its labels and the knob overhang. A value change
+// repaints the old and the new knob position only.
+class SliderWidget : public Widget {
+public:
+  SliderWidget(int x, int y, int w, int h, const ui::SliderSpec &spec, int value);
+  void setValue(int value);
+  int value() const { return value_; }
+  void addOps(DisplayList &list) const override;
+
+private:
+  ui::SliderSpec spec_;
+  int value_;
+};
+
+// Centers the largest square that fits; the matrix is referenced, not copied.
+class QrWidget : public Widget {
+public:
+  QrWidget(QrRenderer &renderer, int x, int y, int w, int h, uint16_t fg, uint16_t bg);
+  // Null leaves the box blank. Call again after changing the matrix in place.
+  void setMatrix(const QrMatrix *matrix);
+  bool drawn() const { return drawn_; }
+  bool direct() const override { return true; }
+  void draw(DisplaySt7789 &display) override;
+
+private:
+  QrRenderer &renderer_;
+  uint16_t fg_;
+  uint16_t bg_;
+  const QrMatrix *matrix_ = nullptr;
+  bool drawn_ = false;
+};
+
+// Full-screen static layer: its flash snapshot when a whole screen is shown with
+// snapshots on, otherwise the layer ops, which rasterize to the same pixels.
+class ImageWidget : public Widget {
+public:
+  explicit ImageWidget(ui::ScreenLayer layer);
+  void setSnapshot(bool on) { snapshot_ = on; }
+  bool snapshot() const { return snapshot_; }
+  void addOps(DisplayList &list) const override { ui::addScreenLayer(layer_, list); }
+  void blitSnapshot(DisplaySt7789 &display) const;
+
+private:
+  ui::ScreenLayer layer_;
+  bool snapshot_ = true;
+};
+
+struct WidgetFrameStats {
+  // Renders that repainted anything.
+  uint32_t frames = 0;
+  uint32_t fullFrames = 0;
+  uint32_t widgets = 0;
+  uint64_t pixels = 0;
+  uint32_t lastUs = 0;
+  uint32_t maxUs = 0;
+  uint64_t totalUs = 0;
+};
+
+// One screen: a backdrop plus widgets in z-order. Shown screens start fully damaged.
+class WidgetScreen {
+public:
+  static constexpr int MaxWidgets = 8;
+
+  explicit WidgetScreen(ImageWidget &backdrop);
+  bool add(Widget &widget);
+  // Repaint everything on the next render, e.g. after something else drew over it.
+  void invalidate() { full_ = true; }
+  // Repaints the damage; false when there was none. The time includes the flush.
+  bool render(DisplaySt7789 &display);
+  // For comparison: every render with damage repaints the whole screen.
+  void setFullRepaint(bool on) { fullRepaint_ = on; }
+  ImageWidget &backdrop() { return backdrop_; }
+  const WidgetFrameStats &stats() const { return stats_; }
+  void resetStats() { stats_ = WidgetFrameStats(); }
+
+private:
+  void renderRegion(DisplaySt7789 &display, const ui::ScreenRect &r);
+
+  ImageWidget &backdrop_;
+  Widget *widgets_[MaxWidgets] = {};
+  int count_ = 0;
+  bool full_ = true;
+  bool fullRepaint_ = false;
+  WidgetFrameStats stats_;
+};
+
+}  // namespace aiw
@@ -24,6 +24,14 @@ bool WifiManager::connect(const char *ssid, const char *password, uint32_t timeo
   return true;
 }
 
+// Kicks off association and returns at once; poll isConnected() from loop().
+bool WifiManager::startConnect(const char *ssid, const char *password) {
+  if (!ssid || !ssid[0]) return false;
+  if (WiFi.status() == WL_CONNECTED) return true;
+  WiFi.begin(ssid, password);
+  return true;
+}
+
 void WifiManager::loop() {
   if (WiFi.status() == WL_CONNECTED) return;
 }
@@ -8,6 +8,7 @@ class WifiManager {
 public:
   void begin();
   bool connect(const char *ssid, const char *password, uint32_t timeoutMs);
+  bool startConnect(const char *ssid, const char *password);
   void loop();
   bool isConnected() const;
   String ip() const;
@@ -1,6 +1,5 @@
 #include "app/zh_bitmaps.h"
 
-#include "app/display_st7789.h"
 #include "app/zh_font_gb1_28_subset.h"
 
 #include <stddef.h>
@@ -115,7 +114,7 @@ const MonoGlyph16 *findZhGlyph(uint32_t codepoint) {
   return nullptr;
 }
 
-static bool utf8Next(const char *s, size_t &i, uint32_t &cp) {
+bool utf8Next(const char *s, size_t &i, uint32_t &cp) {
   uint8_t c = (uint8_t)s[i];
   if (c == 0) return false;
   if (c < 0x80) {
@@ -151,66 +150,4 @@ static bool utf8Next(const char *s, size_t &i, uint32_t &cp) {
   return true;
 }
 
-static void drawGlyph16(DisplaySt7789 &display, int x, int y, const uint8_t *rows, uint16_t fg, uint16_t bg) {
-  for (int r = 0; r < 16; ++r) {
-    uint8_t a0 = rows[r * 2 + 0];
-    uint8_t a1 = rows[r * 2 + 1];
-    uint8_t b0 = (g_renderMode & 0x01u) ? a1 : a0;
-    uint8_t b1 = (g_renderMode & 0x01u) ? a0 : a1;
-    for (int c = 0; c < 8; ++c) {
-      bool on = (g_renderMode & 0x02u) ? ((b0 & (0x01u << c)) != 0) : ((b0 & (0x80u >> c)) != 0);
-      display.fillRect(x + c, y + r, 1, 1, on ? fg : bg);
-    }
-    for (int c = 0; c < 8; ++c) {
-      bool on = (g_renderMode & 0x02u) ? ((b1 & (0x01u << c)) != 0) : ((b1 & (0x80u >> c)) != 0);
-      display.fillRect(x + 8 + c, y + r, 1, 1, on ? fg : bg);
-    }
-  }
-}
-
-void drawZhText16(DisplaySt7789 &display, int x, int y, const char *utf8, uint16_t fg, uint16_t bg) {
-  if (!utf8) return;
-  size_t i = 0;
-  int cx = x;
-  while (true) {
-    uint32_t cp = 0;
-    if (!utf8Next(utf8, i, cp)) break;
-    const MonoGlyph16 *g = findZhGlyph(cp);
-    if (g) {
-      drawGlyph16(display, cx, y, g->rows, fg, bg);
-      cx += 16;
-    } else {
-      cx += 8;
-    }
-  }
-}
-
-static void drawGlyph28Bpp4(DisplaySt7789 &display, int x, int y, const ZhGlyph28 &g, uint16_t fg, uint16_t bg) {
-  int idx = 0;
-  for (int r = 0; r < (int)g.box_h; ++r) {
-    for (int c = 0; c < (int)g.box_w; ++c) {
-      uint8_t b = g.data[idx / 2];
-      uint8_t v = (idx % 2 == 0) ? (uint8_t)((b >> 4) & 0x0Fu) : (uint8_t)(b & 0x0Fu);
-      bool on = v >= 4;
-      display.fillRect(x + c, y + r, 1, 1, on ? fg : bg);
-      idx++;
-    }
-  }
-}
-
-void drawZhText28(DisplaySt7789 &display, int x, int y, const char *utf8, uint16_t fg, uint16_t bg) {
-  if (!utf8) return;
-  size_t i = 0;
-  int cx = x;
-  while (true) {
-    uint32_t cp = 0;
-    if (!utf8Next(utf8, i, cp)) break;
-    const ZhGlyph28 *g = findZhGlyph28(cp);
-    if (g) {
-      drawGlyph28Bpp4(display, cx, y, *g, fg, bg);
-    }
-    cx += 28;
-  }
-}
-
 }  // namespace aiw
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <stddef.h>
 #include <stdint.h>
 
 namespace aiw {
@@ -10,8 +11,9 @@ struct MonoGlyph16 {
 };
 
 const MonoGlyph16 *findZhGlyph(uint32_t codepoint);
-void drawZhText16(class DisplaySt7789 &display, int x, int y, const char *utf8, uint16_t fg, uint16_t bg);
-void drawZhText28(class DisplaySt7789 &display, int x, int y, const char *utf8, uint16_t fg, uint16_t bg);
+// Decodes the code point at s[i] and advances i; malformed bytes give U+FFFD. False at
+// the terminating NUL.
+bool utf8Next(const char *s, size_t &i, uint32_t &cp);
 void setZhRenderMode(uint8_t mode);
 uint8_t zhRenderMode();
 
@@ -3,12 +3,24 @@
 #include <string.h>
 #include <math.h>
 #include <Wire.h>
+#include <Preferences.h>
 #include <HTTPClient.h>
 #include <WiFiClientSecure.h>
 
 #include "app/app_config.h"
+#include "app/async_tare.h"
+#include "app/auto_zero.h"
+#include "app/boot_profiler.h"
+#include "app/display_bench.h"
 #include "app/display_st7789.h"
 #include "app/hx711.h"
+#include "app/hx711_array.h"
+#include "app/hx711_bench.h"
+#include "app/hx711_sampler.h"
+#include "app/noise_floor.h"
+#include "app/weigh_pipeline.h"
+#include "app/weigh_profile.h"
+#include "app/weight_filter.h"
 #include "app/audio_player.h"
 #include "app/gacha_controller.h"
 #include "app/touch_button.h"
@@ -20,8 +32,9 @@
 #include "app/seven_seg.h"
 #include "app/wifi_manager.h"
 #include "app/ai_client.h"
+#include "app/app_screens.h"
 #include "app/zh_bitmaps.h"
-#include "app/mini_font.h"
+#include "app/ui_screens.h"
 #include "app/i2c_bus.h"
 #include "app/receipt_printer.h"
 
@@ -29,10 +42,36 @@ static aiw::DisplaySt7789 display({.mosi = 6, .sclk = 7, .cs = 5, .dc = 4, .rst
 static aiw::SevenSeg sevenSeg(display);
 static aiw::QrRenderer qrRenderer(display);
 static aiw::WifiManager wifi;
-static aiw::Hx711 hx711A({.dout = aiw::config::Hx711DoutPin, .sck = aiw::config::Hx711SckPin});
-static aiw::Hx711 hx711B({.dout = aiw::config::Hx711SckPin, .sck = aiw::config::Hx711DoutPin});
+static aiw::Hx711 hx711A({.dout = aiw::config::Hx711DoutPin, .sck = aiw::config::Hx711SckPin, .rate = aiw::config::Hx711RatePin});
+static aiw::Hx711 hx711B({.dout = aiw::config::Hx711SckPin, .sck = aiw::config::Hx711DoutPin, .rate = aiw::config::Hx711RatePin});
 static aiw::Hx711 *hx711 = &hx711A;
 
+static aiw::Hx711ArrayPins hx711ArrayPins() {
+  aiw::Hx711ArrayPins p;
+  p.sck = aiw::config::Hx711SckPin;
+  p.dout[0] = aiw::config::Hx711DoutPin;
+  p.count = 1;
+  p.rate = aiw::config::Hx711RatePin;
+  const int extra[] = {aiw::config::Hx711Dout2Pin, aiw::config::Hx711Dout3Pin, aiw::config::Hx711Dout4Pin};
+  for (int pin : extra) {
+    if (pin >= 0) p.dout[p.count++] = pin;
+  }
+  return p;
+}
+
+static aiw::Hx711Array hx711Array(hx711ArrayPins());
+static bool hx711ArrayActive = false;
+static aiw::LoadCellAdc *adc = &hx711A;
+static aiw::Hx711Sampler hx711Sampler;
+static aiw::BootProfiler bootProfiler;
+static int bootWifiPhase = -1;
+static int bootScalePhase = -1;
+static int bootTarePhase = -1;
+static bool bootReported = false;
+static volatile bool scaleBootDone = false;
+static volatile bool scaleBootOk = false;
+static bool scaleBootHandled = false;
+
 static aiw::PaymentClient payment(aiw::config::BackendBaseUrl);
 static aiw::QrClient qrClient(aiw::config::BackendBaseUrl);
 static aiw::AiClient aiClient(aiw::config::BackendBaseUrl);
@@ -65,19 +104,7 @@ static int uiTouchLastX = 0;
 static int uiTouchLastY = 0;
 static uint32_t uiTouchStartMs = 0;
 
-static constexpr uint16_t ColorWhite = 0xFFFF;
-static constexpr uint16_t ColorBlack = 0x0000;
-static constexpr uint16_t ColorRed = 0xF800;
-static constexpr uint16_t ColorBlue = 0x001F;
-static constexpr uint16_t ColorGreen = 0x07E0;
-static constexpr uint16_t ColorGray = 0xC618;
-
-static const char kZhSelectHeight[] = "\xE9\x80\x89\xE6\x8B\xA9\xE8\xBA\xAB\xE9\xAB\x98";
-static const char kZhScanPay[] = "\xE6\x89\xAB\xE7\xA0\x81\xE6\x94\xAF\xE4\xBB\x98";
-static const char kZhTare[] = "去皮";
-static const char kZhBack[] = "返回";
-static const char kZhCancel[] = "取消";
-static const char kZhNext[] = "下一步";
+using namespace aiw::ui;
 
 static constexpr int WeightX = 10;
 static constexpr int WeightY = 10;
@@ -91,79 +118,270 @@ static constexpr int StateDotX = 300;
 static constexpr int StateDotY = 22;
 static constexpr int StateDotSize = 16;
 
-static constexpr int HeaderH = 66;
-static constexpr int QrMargin = 6;
-static constexpr int FooterH = 44;
-static constexpr int FooterY = aiw::DisplaySt7789::Height - FooterH - 4;
-
-static constexpr int HeightSliderX = 30;
-static constexpr int HeightSliderY = 132;
-static constexpr int HeightSliderW = 260;
-static constexpr int HeightSliderH = 26;
-
-static constexpr int HeightBtnY = 164;
-static constexpr int HeightBtnH = 68;
-static constexpr int HeightLeftX = 14;
-static constexpr int HeightLeftW = 86;
-static constexpr int HeightNextX = 108;
-static constexpr int HeightNextW = 104;
-static constexpr int HeightRightX = 220;
-static constexpr int HeightRightW = 86;
-
-static constexpr int WeighBtnY = FooterY;
-static constexpr int WeighBtnH = FooterH;
-static constexpr int WeighTareX = 10;
-static constexpr int WeighTareW = 120;
-static constexpr int WeighBackX = 190;
-static constexpr int WeighBackW = 120;
-
-static constexpr int PayCancelX = 90;
-static constexpr int PayCancelY = FooterY;
-static constexpr int PayCancelW = 140;
-static constexpr int PayCancelH = FooterH;
-
-static void qrLayout(int &x, int &y, int &size) {
-  y = HeaderH + QrMargin;
-  int maxH = FooterY - y - QrMargin;
-  int maxW = aiw::DisplaySt7789::Width - 2 * QrMargin;
-  size = maxH < maxW ? maxH : maxW;
-  if (size < 0) size = 0;
-  x = (aiw::DisplaySt7789::Width - size) / 2;
-}
-
-static constexpr int StableWindow = 6;
-static constexpr int32_t ZeroSnapDelta = 200;
-static constexpr int32_t PayTriggerDelta = 800;
-static constexpr float DisplayStep = 0.1f;
-static constexpr float DisplayHysteresis = 0.15f;
-static constexpr float StableUnlockDelta = 0.3f;
-static int32_t deltaWindow[StableWindow];
-static int weightWindowCount = 0;
-static int weightWindowIndex = 0;
-static int stableHits = 0;
-static bool hasLastDelta = false;
-static int32_t lastDelta = 0;
-static uint32_t glitchCount = 0;
-static bool filteredInit = false;
-static float filteredDelta = 0.0f;
-static bool hasLastFilteredDelta = false;
-static int32_t lastFilteredDelta = 0;
-static bool displayLocked = false;
-static float lockedWeight = 0.0f;
-static bool hasLastShownWeight = false;
+static constexpr uint16_t StableWindowLengths[] = {0, 6, 16, 64, 128, 256, 512};
+static aiw::WeightFilter<aiw::StableWindowCapacity> weightFilter;
+static uint16_t stableWindowLength = 0;
+static const char *const EstimatorModeNames[] = {"off", "step", "step+sway"};
+static uint8_t estimatorMode = 2;
 static float lastShownWeight = 0.0f;
+static aiw::WeighProfileId weighProfileId = aiw::WeighProfileId::Person;
+static aiw::SampleAverager weighAverager;
+static aiw::PayTrigger payTrigger;
+static uint32_t lastWeighSampleMs = 0;
+static bool captureEnabled = false;
+static aiw::AutoZeroTracker autoZero;
+static uint32_t lastAutoZeroLogMs = 0;
+static constexpr uint32_t TareTimeoutMs = 15000;
+static aiw::AsyncTare tareJob;
+static uint32_t tareStartMs = 0;
+static bool tareUiDirty = false;
+static aiw::NoiseFloorEstimator noiseFloor;
+static aiw::NoiseThresholds noiseThresholds = {};
+static char noiseKey[16] = "";
+static float noiseSavedSigma = 0.0f;
+static uint32_t noiseSavedMs = 0;
+static constexpr uint32_t NoiseSaveIntervalMs = 600000;
+
+static const aiw::WeighProfile &activeProfile() {
+  return aiw::weighProfile(weighProfileId);
+}
+
+static int weighAverageSamples() {
+  return aiw::weighProfileAverage(activeProfile(), adc->rateSps());
+}
+
+// Without a RATE pin the strapped rate wins and only the averaging follows the profile.
+static int profileRate(const aiw::WeighProfile &p) {
+  return p.rateSps && adc->hasRateControl() ? p.rateSps : aiw::config::Hx711Rate;
+}
+
+static void loadWeighProfile() {
+  Preferences prefs;
+  if (!prefs.begin("aiw_weigh", true)) return;
+  uint8_t id = prefs.getUChar("profile", (uint8_t)weighProfileId);
+  prefs.end();
+  if (id < aiw::WeighProfileCount) weighProfileId = (aiw::WeighProfileId)id;
+}
+
+static void saveWeighProfile() {
+  Preferences prefs;
+  if (!prefs.begin("aiw_weigh", false)) return;
+  prefs.putUChar("profile", (uint8_t)weighProfileId);
+  prefs.end();
+}
+
+struct NoiseRecord {
+  float sigma;
+  uint32_t windows;
+};
+
+// Noise differs per rate and gain, so each combination keeps its own record.
+static void noiseRecordKey(char *out, size_t n) {
+  snprintf(out, n, "n%d_%d", adc->rateSps(), adc->pgaGain());
+}
+
+static void loadNoiseFloor() {
+  noiseRecordKey(noiseKey, sizeof(noiseKey));
+  noiseFloor.reset();
+  noiseSavedSigma = 0.0f;
+  Preferences prefs;
+  if (!prefs.begin("aiw_noise", true)) return;
+  NoiseRecord rec{};
+  if (prefs.getBytes(noiseKey, &rec, sizeof(rec)) == sizeof(rec)) {
+    noiseFloor.seed(rec.sigma, rec.windows);
+    noiseSavedSigma = rec.sigma;
+  }
+  prefs.end();
+}
+
+static void saveNoiseFloor() {
+  Preferences prefs;
+  if (!prefs.begin("aiw_noise", false)) return;
+  NoiseRecord rec{noiseFloor.sigma(), noiseFloor.windows()};
+  prefs.putBytes(noiseKey, &rec, sizeof(rec));
+  prefs.end();
+  noiseSavedSigma = rec.sigma;
+  noiseSavedMs = millis();
+}
+
+static void clearNoiseFloor() {
+  Preferences prefs;
+  if (prefs.begin("aiw_noise", false)) {
+    prefs.remove(noiseKey);
+    prefs.end();
+  }
+  noiseFloor.reset();
+  noiseSavedSigma = 0.0f;
+}
+
+// Sigma of one filter input, i.e. after weighAverager.
+static float noiseSigmaAveraged() {
+  return noiseFloor.sigma() / sqrtf((float)weighAverageSamples());
+}
+
+static void logNoiseFloor(const char *tag) {
+  const aiw::NoiseThresholds &th = noiseThresholds;
+  Serial.printf("noise %s key=%s ready=%d sigma_raw=%.1f sigma_avg=%.1f windows=%lu rejected=%lu saved=%.1f zero_snap=%ld stable_base=%ld stable_max=%ld pay_trigger=%ld glitch=%ld\n", tag, noiseKey, noiseFloor.ready() ? 1 : 0, noiseFloor.sigma(), noiseSigmaAveraged(), (unsigned long)noiseFloor.windows(), (unsigned long)noiseFloor.rejectedWindows(), noiseSavedSigma, (long)th.zeroSnapCounts, (long)th.stableBaseCounts, (long)th.stableMaxCounts, (long)th.payTriggerCounts, (long)th.glitchCounts);
+}
 
-static void resetDeltaWindow() {
-  weightWindowCount = 0;
-  weightWindowIndex = 0;
-  stableHits = 0;
-  displayLocked = false;
-  hasLastShownWeight = false;
+static aiw::WeightFilterConfig weightFilterConfig() {
+  aiw::WeightFilterConfig cfg = aiw::makeWeighProfileConfig(activeProfile(), adc->scale(), adc->rateSps());
+  aiw::applyFilterThresholds(cfg, noiseThresholds);
+  if (stableWindowLength > 0) {
+    cfg.stabilityMode = aiw::StabilityMode::Window;
+    cfg.stableWindow = stableWindowLength;
+  }
+  cfg.predictSettling = cfg.predictSettling && estimatorMode >= 1;
+  cfg.swayDetect = cfg.swayDetect && estimatorMode >= 2;
+  return cfg;
+}
+
+static void applyNoiseThresholds() {
+  noiseThresholds = aiw::currentNoiseThresholds(noiseFloor, weighAverageSamples(), adc->scale(), activeProfile().stepKg);
+  aiw::applyTriggerThresholds(noiseThresholds, activeProfile().holdMs, payTrigger, noiseFloor);
+}
+
+static void configureWeightFilter() {
+  char key[sizeof(noiseKey)];
+  noiseRecordKey(key, sizeof(key));
+  if (strcmp(key, noiseKey) != 0) loadNoiseFloor();
+  applyNoiseThresholds();
+  weightFilter.configure(weightFilterConfig());
+  weightFilter.reset();
+  autoZero.configure(aiw::makeAutoZeroConfig(adc->scale(), activeProfile().stepKg));
+  autoZero.reset();
+}
+
+static void logAutoZero(const char *tag) {
+  const aiw::AutoZeroStats &st = autoZero.stats();
+  float scale = adc->scale();
+  Serial.printf("autozero %s enabled=%d corrections=%lu total=%ld (%.3fkg) last=%ld range=[%ld,%ld] empty=%lu motion=%lu loaded=%lu limit_hits=%lu\n", tag, autoZero.enabled() ? 1 : 0, (unsigned long)st.corrections, (long)st.totalCounts, scale > 0.0f ? (float)st.totalCounts / scale : 0.0f, (long)st.lastStepCounts, (long)st.minTotalCounts, (long)st.maxTotalCounts, (unsigned long)st.emptyWindows, (unsigned long)st.motionWindows, (unsigned long)st.loadedWindows, (unsigned long)st.limitHits);
+}
+
+static void startTare() {
+  int32_t motion = (int32_t)(adc->scale() * activeProfile().stepKg * (float)aiw::TareMotionSteps + 0.5f);
+  if (motion < 100) motion = 100;
+  tareJob.start(adc->averageSamples() * 6, motion, aiw::TareMaxAttempts);
+  tareStartMs = millis();
+  tareUiDirty = true;
+  Serial.printf("tare start samples=%d motion=%ld\n", adc->averageSamples() * 6, (long)motion);
+}
+
+static void finishTare() {
+  tareUiDirty = true;
+  bootProfiler.end(bootTarePhase);
+  if (tareJob.state() != aiw::TareState::Done) {
+    Serial.printf("tare rejected attempts=%u range=%ld\n", (unsigned)tareJob.attempts(), (long)tareJob.lastRange());
+    return;
+  }
+  adc->setOffset(tareJob.offset());
+  autoZero.reset();
+  weighAverager.reset();
+  weightFilter.reset();
+  payTrigger.reset();
+  Serial.printf("tare done offset=%ld attempts=%u\n", (long)tareJob.offset(), (unsigned)tareJob.attempts());
+}
+
+static void pollTareTimeout() {
+  if (!tareJob.busy() || millis() - tareStartMs < TareTimeoutMs) return;
+  tareJob.cancel();
+  tareUiDirty = true;
+  bootProfiler.end(bootTarePhase);
+  Serial.println("tare rejected: timeout");
 }
 
-static float quantize(float v, float step) {
-  if (step <= 0.0f) return v;
-  return roundf(v / step) * step;
+// Runs only after a window of empty-platform samples, so retuning cannot disturb a weighing.
+static void onNoiseWindow() {
+  aiw::NoiseThresholds th = aiw::currentNoiseThresholds(noiseFloor, weighAverageSamples(), adc->scale(), activeProfile().stepKg);
+  if (aiw::noiseThresholdsDiffer(th, noiseThresholds)) {
+    applyNoiseThresholds();
+    weightFilter.configure(weightFilterConfig());
+    logNoiseFloor("retune");
+  }
+  if (!noiseFloor.ready()) return;
+  float sigma = noiseFloor.sigma();
+  bool moved = noiseSavedSigma <= 0.0f || fabsf(sigma - noiseSavedSigma) > noiseSavedSigma * 0.15f;
+  if (moved && (noiseSavedMs == 0 || millis() - noiseSavedMs > NoiseSaveIntervalMs)) {
+    saveNoiseFloor();
+    logNoiseFloor("saved");
+  }
+}
+
+static bool popScaleSample(aiw::Hx711Sample &s) {
+  if (!hx711Sampler.pop(s)) return false;
+  if (tareJob.busy()) {
+    uint8_t pct = tareJob.progress();
+    if (tareJob.push(s.raw)) {
+      finishTare();
+    } else if (tareJob.progress() != pct) {
+      tareUiDirty = true;
+    }
+    return true;
+  }
+  int32_t zeroStep = 0;
+  uint32_t limitHits = autoZero.stats().limitHits;
+  if (autoZero.push(s.raw - adc->offset(), millis(), zeroStep)) {
+    adc->setOffset(adc->offset() + zeroStep);
+    uint32_t now = millis();
+    if (autoZero.stats().limitHits != limitHits) {
+      logAutoZero("limit");
+    } else if (now - lastAutoZeroLogMs > 60000) {
+      lastAutoZeroLogMs = now;
+      logAutoZero("drift");
+    }
+  }
+  if (noiseFloor.push(s.raw - adc->offset())) {
+    onNoiseWindow();
+  }
+  if (captureEnabled) {
+    Serial.printf("cap,%lu,%ld,%ld,%.3f\n", (unsigned long)s.timestampUs, (long)s.raw, (long)adc->offset(), adc->scale());
+  }
+  return true;
+}
+
+static void drainScaleSamples() {
+  aiw::Hx711Sample s;
+  while (popScaleSample(s)) {
+  }
+}
+
+static void resetWeighSamples() {
+  drainScaleSamples();
+  weighAverager.reset();
+  lastWeighSampleMs = millis();
+}
+
+static bool takeWeighSample(int32_t &rawOut) {
+  aiw::Hx711Sample s;
+  while (popScaleSample(s)) {
+    lastWeighSampleMs = millis();
+    if (tareJob.busy()) continue;
+    if (weighAverager.push(s.raw, rawOut)) return true;
+  }
+  return false;
+}
+
+// Keeps the tare offset: only the rate, averaging and filter change, and auto-zero
+// absorbs any small offset shift from a rate change.
+static void setWeighProfile(aiw::WeighProfileId id) {
+  weighProfileId = id;
+  const aiw::WeighProfile &p = activeProfile();
+  int rate = profileRate(p);
+  bool ok = true;
+  if (rate != adc->rateSps()) {
+    // A sampler that failed to stop may still be reading; leave the rate alone.
+    ok = hx711Sampler.end();
+    if (ok) {
+      adc->setRateSps(rate);
+      ok = hx711Sampler.begin(*adc);
+    }
+  }
+  weighAverager.setCount(weighAverageSamples());
+  configureWeightFilter();
+  resetWeighSamples();
+  payTrigger.reset();
+  saveWeighProfile();
+  Serial.printf("weigh profile=%s rate=%dsps sampler=%d avg=%d ema_shift=%u step=%.3fkg hold=%lums\n", p.name, adc->rateSps(), ok ? 1 : 0, weighAverager.count(), (unsigned)p.emaShift, p.stepKg, (unsigned long)p.holdMs);
 }
 
 enum class AppState : uint8_t {
@@ -187,7 +405,6 @@ static aiw::AiWithTtsResult rewardAi;
 static bool rewardAiOk = false;
 static uint32_t lastHx711LogMs = 0;
 static uint32_t lastTareMs = 0;
-static uint32_t stableHoldStartMs = 0;
 static uint32_t lastTouchLogMs = 0;
 static uint8_t touchMapMode = 0x06;
 static uint32_t lastHeightBtnMs = 0;
@@ -240,43 +457,8 @@ static void setState(AppState s) {
   uiDirty = true;
 }
 
-static void pushDelta(int32_t d) {
-  deltaWindow[weightWindowIndex] = d;
-  weightWindowIndex = (weightWindowIndex + 1) % StableWindow;
-  if (weightWindowCount < StableWindow) weightWindowCount++;
-}
-
-static bool computeStableDelta(int32_t &meanOut, int32_t &rangeOut) {
-  const int n = weightWindowCount < StableWindow ? weightWindowCount : StableWindow;
-  if (n < 4) return false;
-  int32_t minV = deltaWindow[0];
-  int32_t maxV = deltaWindow[0];
-  int64_t sum = 0;
-  for (int i = 0; i < n; ++i) {
-    int32_t v = deltaWindow[i];
-    if (v < minV) minV = v;
-    if (v > maxV) maxV = v;
-    sum += v;
-  }
-  meanOut = (int32_t)(sum / (int64_t)n);
-  rangeOut = (int32_t)(maxV - minV);
-  int32_t absMean = meanOut < 0 ? -meanOut : meanOut;
-  int32_t threshold = absMean / 40;
-  if (threshold < 160) threshold = 160;
-  if (threshold > 900) threshold = 900;
-  if (rangeOut > threshold) return false;
-  if (absMean < 30) return false;
-  return true;
-}
-
-static void drawUiFrame() {
-  display.beginWrite();
-  display.clear(ColorWhite);
-  display.drawBorder(ColorBlack, 2);
-  display.fillRect(0, HeaderH, aiw::DisplaySt7789::Width, 1, ColorGray);
-  display.fillRect(80, 6, 1, HeaderH - 12, ColorGray);
-  display.endWrite();
-}
+static aiw::AppScreens screens(sevenSeg, qrRenderer, currentHeightCm);
+static aiw::WidgetScreen *activeScreen = nullptr;
 
 static void drawWifiStatus() {
   display.beginWrite();
@@ -290,142 +472,36 @@ static void drawWifiStatus() {
   display.endWrite();
 }
 
-static void fillRoundRect(int x, int y, int w, int h, int r, uint16_t color) {
-  if (w <= 0 || h <= 0) return;
-  if (r < 1) {
-    display.fillRect(x, y, w, h, color);
-    return;
-  }
-  if (r * 2 > w) r = w / 2;
-  if (r * 2 > h) r = h / 2;
-  display.fillRect(x + r, y, w - 2 * r, h, color);
-  display.fillRect(x, y + r, r, h - 2 * r, color);
-  display.fillRect(x + w - r, y + r, r, h - 2 * r, color);
-  for (int dy = 0; dy < r; ++dy) {
-    float fy = (float)dy + 0.5f;
-    float fr = (float)r;
-    int dx = (int)floorf(sqrtf(fr * fr - fy * fy));
-    int sx = r - dx;
-    int ww = w - 2 * sx;
-    if (ww > 0) {
-      display.fillRect(x + sx, y + dy, ww, 1, color);
-      display.fillRect(x + sx, y + h - 1 - dy, ww, 1, color);
-    }
-  }
-}
-
-static void drawButton(int x, int y, int w, int h, uint16_t bg, const char *label) {
-  auto utf8Next = [](const char *s, size_t &i, uint32_t &cp) -> bool {
-    uint8_t c = (uint8_t)s[i];
-    if (c == 0) return false;
-    if (c < 0x80) {
-      cp = c;
-      i += 1;
-      return true;
-    }
-    if ((c & 0xE0) == 0xC0) {
-      uint8_t c1 = (uint8_t)s[i + 1];
-      if ((c1 & 0xC0) != 0x80) {
-        cp = 0xFFFD;
-        i += 1;
-        return true;
-      }
-      cp = ((uint32_t)(c & 0x1F) << 6) | (uint32_t)(c1 & 0x3F);
-      i += 2;
-      return true;
-    }
-    if ((c & 0xF0) == 0xE0) {
-      uint8_t c1 = (uint8_t)s[i + 1];
-      uint8_t c2 = (uint8_t)s[i + 2];
-      if (((c1 & 0xC0) != 0x80) || ((c2 & 0xC0) != 0x80)) {
-        cp = 0xFFFD;
-        i += 1;
-        return true;
-      }
-      cp = ((uint32_t)(c & 0x0F) << 12) | ((uint32_t)(c1 & 0x3F) << 6) | (uint32_t)(c2 & 0x3F);
-      i += 3;
-      return true;
-    }
-    cp = 0xFFFD;
-    i += 1;
-    return true;
-  };
-
-  int r = 10;
-  uint16_t border = 0x7BEF;
-  fillRoundRect(x, y, w, h, r, border);
-  if (w > 4 && h > 4) {
-    fillRoundRect(x + 2, y + 2, w - 4, h - 4, r - 2, bg);
-    display.fillRect(x + 4, y + 4, w - 8, 2, 0xFFFF);
-    display.fillRect(x + 4, y + h - 6, w - 8, 2, 0xAD55);
-  }
-  if (label && label[0]) {
-    bool hasNonAscii = false;
-    for (const char *p = label; *p; ++p) {
-      if ((uint8_t)(*p) >= 0x80u) {
-        hasNonAscii = true;
-        break;
-      }
-    }
-    if (hasNonAscii) {
-      size_t i = 0;
-      int chars = 0;
-      while (true) {
-        uint32_t cp = 0;
-        if (!utf8Next(label, i, cp)) break;
-        chars++;
-      }
-      int tw = chars * 16;
-      int tx = x + (w - tw) / 2;
-      int ty = y + (h - 16) / 2;
-      uint8_t prevMode = aiw::zhRenderMode();
-      aiw::setZhRenderMode(0);
-      aiw::drawZhText16(display, tx, ty, label, ColorBlack, bg);
-      aiw::setZhRenderMode(prevMode);
-    } else {
-      int len = (int)strlen(label);
-      int scale = 2;
-      int tw = len * 6 * scale;
-      int tx = x + (w - tw) / 2;
-      int ty = y + (h - 7 * scale) / 2;
-      aiw::drawText5x7(display, tx, ty, label, ColorBlack, bg, scale);
-    }
-  }
+static void renderScreen() {
+  if (activeScreen) activeScreen->render(display);
 }
 
-static void drawHeaderLabel(const char *label) {
-  display.beginWrite();
-  display.fillRect(2, 2, aiw::DisplaySt7789::Width - 4, HeaderH - 4, ColorWhite);
-  display.fillRect(80, 6, 1, HeaderH - 12, ColorGray);
-  if (label && label[0]) {
-    aiw::drawText5x7(display, 10, 46, label, ColorGray, ColorWhite, 2);
-  }
-  display.endWrite();
+// Full repaint; the wifi icon is not a widget and goes back on top.
+static void showScreen(aiw::WidgetScreen &screen) {
+  activeScreen = &screen;
+  screen.invalidate();
+  screen.render(display);
   drawWifiStatus();
 }
 
-static void drawHeaderScanPay() {
-  display.beginWrite();
-  display.fillRect(2, 2, aiw::DisplaySt7789::Width - 4, HeaderH - 4, ColorWhite);
-  display.fillRect(80, 6, 1, HeaderH - 12, ColorGray);
-  aiw::drawZhText28(display, 12, 8, kZhScanPay, ColorBlack, ColorWhite);
-  display.endWrite();
-  drawWifiStatus();
+static void showStatus(const char *label) {
+  screens.statusLabel.setText(label);
+  screens.setReadouts("", "");
+  showScreen(screens.statusScreen);
 }
 
-static void drawWeighFooter() {
-  display.beginWrite();
-  display.fillRect(2, FooterY, aiw::DisplaySt7789::Width - 4, FooterH, ColorWhite);
-  drawButton(WeighTareX, WeighBtnY, WeighTareW, WeighBtnH, 0xE7FF, kZhTare);
-  drawButton(WeighBackX, WeighBtnY, WeighBackW, WeighBtnH, 0xF7DE, kZhBack);
-  display.endWrite();
-}
-
-static void drawPayFooter() {
-  display.beginWrite();
-  display.fillRect(2, FooterY, aiw::DisplaySt7789::Width - 4, FooterH, ColorWhite);
-  drawButton(PayCancelX, PayCancelY, PayCancelW, PayCancelH, 0xF7DE, kZhCancel);
-  display.endWrite();
+static void updateTareStatus() {
+  int w = WeighTareW - 8;
+  int fill = 0;
+  uint16_t color = ColorBlue;
+  if (tareJob.state() == aiw::TareState::Collecting) {
+    fill = w * tareJob.progress() / 100;
+    if (fill < 2) fill = 2;
+  } else if (tareJob.state() == aiw::TareState::Rejected) {
+    fill = w;
+    color = ColorRed;
+  }
+  screens.tareButton.setBar(fill, color);
 }
 
 static void drawTouchCalTarget(int x, int y) {
@@ -932,15 +1008,10 @@ static bool touchHoldInRect(bool touching, int x, int y, int rx, int ry, int rw,
 static void drawWeight(bool stable, float weight) {
   char wbuf[32];
   char hbuf[8];
-  snprintf(wbuf, sizeof(wbuf), "%.1f", weight);
+  snprintf(wbuf, sizeof(wbuf), "%.*f", (int)activeProfile().decimals, weight);
   snprintf(hbuf, sizeof(hbuf), "%d", (int)lroundf(lastInputHeightCm));
-  display.beginWrite();
-  sevenSeg.clearRect(4, 0, aiw::DisplaySt7789::Width - 4, HeaderH, ColorWhite);
-  display.fillRect(80, 6, 1, HeaderH - 12, ColorGray);
-  sevenSeg.drawText(10, 10, hbuf, 3, ColorGray, ColorWhite);
-  sevenSeg.drawText(100, 6, wbuf, 4, ColorBlack, ColorWhite);
-  display.endWrite();
-  drawWifiStatus();
+  screens.setReadouts(hbuf, wbuf);
+  renderScreen();
 }
 
 static void drawStatusBar(uint16_t color) {
@@ -948,61 +1019,23 @@ static void drawStatusBar(uint16_t color) {
 }
 
 static void drawHeightPicker() {
-  char mid[8];
-  snprintf(mid, sizeof(mid), "%d", currentHeightCm);
-
-  display.beginWrite();
-  display.clear(ColorWhite);
-  display.drawBorder(ColorBlack, 2);
-
-  aiw::drawZhText28(display, 12, 8, kZhSelectHeight, ColorBlack, ColorWhite);
-  display.fillRect(0, 40, aiw::DisplaySt7789::Width, 1, ColorGray);
-
-  sevenSeg.drawText(108, 52, mid, 5, ColorBlack, ColorWhite);
-
-  display.fillRect(HeightSliderX, HeightSliderY, HeightSliderW, HeightSliderH, 0xEF7D);
-  display.fillRect(HeightSliderX, HeightSliderY + HeightSliderH - 2, HeightSliderW, 2, 0xC618);
-  display.fillRect(HeightSliderX, HeightSliderY, HeightSliderW, 2, 0xFFFF);
-  aiw::drawText5x7(display, HeightSliderX - 2, HeightSliderY - 12, "120", ColorGray, ColorWhite, 2);
-  aiw::drawText5x7(display, HeightSliderX + HeightSliderW - 2 - 3 * 12, HeightSliderY - 12, "220", ColorGray, ColorWhite, 2);
-  int knobX = HeightSliderX + (currentHeightCm - 120) * (HeightSliderW - 14) / 100;
-  fillRoundRect(knobX, HeightSliderY - 4, 14, HeightSliderH + 8, 6, 0x5ACB);
-  fillRoundRect(knobX + 2, HeightSliderY - 2, 10, HeightSliderH + 4, 5, 0xE7FF);
-
-  drawButton(HeightLeftX, HeightBtnY, HeightLeftW, HeightBtnH, 0xF7DE, "<");
-
-  drawButton(HeightNextX, HeightBtnY, HeightNextW, HeightBtnH, 0xE7FF, kZhNext);
-
-  drawButton(HeightRightX, HeightBtnY, HeightRightW, HeightBtnH, 0xF7DE, ">");
-
-  display.endWrite();
-  drawWifiStatus();
+  screens.setHeight(currentHeightCm);
+  showScreen(screens.heightScreen);
   drawStatusBar(ColorBlue);
 }
 
 static void updateHeightPickerValueOnly() {
-  char mid[8];
-  snprintf(mid, sizeof(mid), "%d", currentHeightCm);
-  display.beginWrite();
-  sevenSeg.clearRect(4, 40, aiw::DisplaySt7789::Width - 8, 92, ColorWhite);
-  sevenSeg.drawText(108, 52, mid, 5, ColorBlack, ColorWhite);
-  display.fillRect(HeightSliderX, HeightSliderY, HeightSliderW, HeightSliderH, 0xEF7D);
-  display.fillRect(HeightSliderX, HeightSliderY + HeightSliderH - 2, HeightSliderW, 2, 0xC618);
-  display.fillRect(HeightSliderX, HeightSliderY, HeightSliderW, 2, 0xFFFF);
-  aiw::drawText5x7(display, HeightSliderX - 2, HeightSliderY - 12, "120", ColorGray, ColorWhite, 2);
-  aiw::drawText5x7(display, HeightSliderX + HeightSliderW - 2 - 3 * 12, HeightSliderY - 12, "220", ColorGray, ColorWhite, 2);
-  int knobX = HeightSliderX + (currentHeightCm - 120) * (HeightSliderW - 14) / 100;
-  fillRoundRect(knobX, HeightSliderY - 4, 14, HeightSliderH + 8, 6, 0x5ACB);
-  fillRoundRect(knobX + 2, HeightSliderY - 2, 10, HeightSliderH + 4, 5, 0xE7FF);
-  display.endWrite();
-  drawWifiStatus();
+  screens.setHeight(currentHeightCm);
+  renderScreen();
 }
 
 static void enterWeighingFromHeight() {
+  if (!scaleBootHandled) {
+    Serial.println("scale still booting");
+    return;
+  }
   lastInputHeightCm = (float)currentHeightCm;
-  resetDeltaWindow();
-  drawUiFrame();
-  drawWeighFooter();
+  weightFilter.reset();
   drawStatusBar(ColorBlue);
   setState(AppState::Weighing);
 }
@@ -1030,25 +1063,7 @@ static void tryTareNow() {
   uint32_t now = millis();
   if (now - lastTareMs < 1500) return;
   lastTareMs = now;
-  hx711->tare(30, 500);
-  hasLastDelta = false;
-  filteredInit = false;
-  hasLastFilteredDelta = false;
-  displayLocked = false;
-  hasLastShownWeight = false;
-  resetDeltaWindow();
-  drawStatusBar(ColorBlue);
-  Serial.println("tare done");
-}
-
-static void clearQrArea() {
-  int x = 0;
-  int y = 0;
-  int size = 0;
-  qrLayout(x, y, size);
-  display.beginWrite();
-  display.fillRect(0, y, aiw::DisplaySt7789::Width, FooterY - y, ColorWhite);
-  display.endWrite();
+  startTare();
 }
 
 static void printerSelfTest() {
@@ -1244,31 +1259,115 @@ static bool postJson(const String &url, const String &body, int &outCode, String
   }
 }
 
+static void scaleBootBody() {
+  int phase = bootProfiler.begin("hx711_probe");
+  if (hx711Array.channelCount() > 1) {
+    hx711Array.begin();
+    uint32_t probeStart = millis();
+    while (!hx711Array.isReady() && millis() - probeStart < 500) delay(1);
+    uint32_t mask = hx711Array.readyMask();
+    Serial.printf("hx711 array channels=%d sck=%d ready_mask=0x%lx\n", hx711Array.channelCount(), aiw::config::Hx711SckPin, (unsigned long)mask);
+    hx711ArrayActive = true;
+    adc = &hx711Array;
+  } else {
+    hx711A.begin();
+    int32_t rawA = hx711A.readRaw(500);
+    if (rawA == INT32_MIN) {
+      hx711B.begin();
+      int32_t rawB = hx711B.readRaw(500);
+      if (rawB != INT32_MIN) {
+        hx711 = &hx711B;
+        adc = &hx711B;
+        Serial.printf("hx711 pins swapped dout=%d sck=%d\n", aiw::config::Hx711SckPin, aiw::config::Hx711DoutPin);
+      } else {
+        Serial.printf("hx711 no data dout=%d sck=%d\n", aiw::config::Hx711DoutPin, aiw::config::Hx711SckPin);
+      }
+    } else {
+      Serial.printf("hx711 ok dout=%d sck=%d raw=%ld\n", aiw::config::Hx711DoutPin, aiw::config::Hx711SckPin, (long)rawA);
+      if (rawA == 0) {
+        Serial.println("hx711 raw=0 (dout may be floating/shorted or wrong pins)");
+      }
+    }
+    if (aiw::config::Hx711ReadMode == (uint8_t)aiw::Hx711ReadMode::Spi && !hx711->setReadMode(aiw::Hx711ReadMode::Spi)) {
+      Serial.println("hx711 spi read init failed, using bitbang");
+    }
+    Serial.printf("hx711 read mode=%s\n", aiw::hx711ReadModeName(hx711->readMode()));
+  }
+  loadWeighProfile();
+  if (!adc->setRateSps(profileRate(activeProfile()))) {
+    Serial.println("hx711 rate pin not wired, assuming strapped rate");
+  }
+  if (aiw::config::Hx711Gain == 32) {
+    Serial.println("hx711 gain 32 is channel B, not calibrated for weighing; using 128");
+    adc->setPgaGain(128);
+  } else {
+    adc->setPgaGain(aiw::config::Hx711Gain);
+  }
+  Serial.printf("%s rate=%dsps gain=%d profile=%s\n", adc->name(), adc->rateSps(), adc->pgaGain(), activeProfile().name);
+  adc->setScale(aiw::config::Hx711Scale);
+  noiseFloor.configure(aiw::PayTriggerDelta / 2);
+  configureWeightFilter();
+  weighAverager.setCount(weighAverageSamples());
+  logNoiseFloor("boot");
+  bootProfiler.end(phase);
+  phase = bootProfiler.begin("hx711_sampler");
+  scaleBootOk = hx711Sampler.begin(*adc);
+  Serial.printf("hx711 sampler started=%d channels=%d\n", scaleBootOk ? 1 : 0, hx711ArrayActive ? hx711Array.channelCount() : 1);
+  bootProfiler.end(phase);
+  scaleBootDone = true;
+}
+
+static void scaleBootTask(void *) {
+  scaleBootBody();
+  vTaskDelete(nullptr);
+}
+
 void setup() {
+  int phase = bootProfiler.begin("serial");
   Serial.begin(115200);
-  delay(200);
   touchApplyConfigDefaults();
   aiw::i2cBusInit(aiw::config::I2cSdaPin, aiw::config::I2cSclPin, 100000);
+  bootProfiler.end(phase);
 
+  phase = bootProfiler.begin("display");
   display.begin();
+  display.setClockHz(aiw::config::DisplaySpiHz);
+  if (aiw::config::DisplayDma && !display.setBusMode(aiw::DisplayBusMode::Dma)) {
+    Serial.println("display dma init failed, using blocking spi");
+  }
+  if (aiw::config::DisplayFramebuffer && !display.setFramebuffer(true)) {
+    Serial.println("display framebuffer needs psram, drawing direct");
+  }
+  Serial.printf("display bus=%s clock=%luHz framebuffer=%d\n", aiw::displayBusModeName(display.busMode()), (unsigned long)display.clockHz(), display.framebuffer() ? 1 : 0);
   aiw::setZhRenderMode(3);
-  drawUiFrame();
   drawHeightPicker();
   uiDirty = false;
   heightTouchPrev = false;
+  bootProfiler.end(phase);
 
+  phase = bootProfiler.begin("wifi_start");
   wifi.begin();
-  bool ok = wifi.connect(aiw::config::WifiSsid, aiw::config::WifiPassword, 15000);
-  Serial.printf("wifi=%s ip=%s\n", ok ? "connected" : "timeout", wifi.ip().c_str());
+  wifi.startConnect(aiw::config::WifiSsid, aiw::config::WifiPassword);
+  bootProfiler.end(phase);
+  bootWifiPhase = bootProfiler.begin("wifi_connect");
   Serial.printf("backend=%s\n", aiw::config::BackendBaseUrl);
   Serial.printf("gacha pin=%d activeHigh=%d pulseMs=%lu\n", aiw::config::GachaPin, aiw::config::GachaActiveHigh ? 1 : 0, (unsigned long)aiw::config::GachaPulseMs);
   Serial.printf("audio enabled=%d bclk=%d lrck=%d dout=%d mclk=%d pa=%d i2c_sda=%d i2c_scl=%d codec=0x%02X vol=%d\n", aiw::config::AudioEnabled ? 1 : 0, aiw::config::I2sBclkPin, aiw::config::I2sLrckPin, aiw::config::I2sDoutPin, aiw::config::I2sMclkPin, aiw::config::PaCtrlPin, aiw::config::I2cSdaPin, aiw::config::I2cSclPin, (unsigned)aiw::config::CodecI2cAddr, aiw::config::AudioVolume);
   Serial.printf("touch pin=%d threshold=%u\n", aiw::config::TouchPin, (unsigned)aiw::config::TouchThreshold);
   drawWifiStatus();
 
+  bootScalePhase = bootProfiler.begin("scale_boot");
+  if (xTaskCreatePinnedToCore(scaleBootTask, "aiw_boot", 4096, nullptr, 2, nullptr, 0) != pdPASS) {
+    scaleBootBody();
+  }
+
+  phase = bootProfiler.begin("peripherals");
   gacha.begin(aiw::config::GachaPin, aiw::config::GachaActiveHigh, aiw::config::GachaPulseMs);
   audioPlayer.begin(aiw::config::AudioEnabled, aiw::config::I2sBclkPin, aiw::config::I2sLrckPin, aiw::config::I2sDoutPin, aiw::config::I2sMclkPin, aiw::config::PaCtrlPin, aiw::config::I2cSdaPin, aiw::config::I2cSclPin, aiw::config::CodecI2cAddr, aiw::config::AudioVolume);
   touchBtn.begin(BootPin, aiw::config::TouchPin, aiw::config::TouchThreshold);
+  bootProfiler.end(phase);
+
+  phase = bootProfiler.begin("touch");
   touchScreen.begin(aiw::config::I2cSdaPin, aiw::config::I2cSclPin, 0);
   bool touchOk = touchScreen.detect();
   if (!touchOk) {
@@ -1283,26 +1382,9 @@ void setup() {
     Serial.println("touch i2c scan:");
     i2cScanBus(aiw::config::I2cSdaPin, aiw::config::I2cSclPin);
   }
+  bootProfiler.end(phase);
 
-  hx711A.begin();
-  int32_t rawA = hx711A.readRaw(500);
-  if (rawA == INT32_MIN) {
-    hx711B.begin();
-    int32_t rawB = hx711B.readRaw(500);
-    if (rawB != INT32_MIN) {
-      hx711 = &hx711B;
-      Serial.printf("hx711 pins swapped dout=%d sck=%d\n", aiw::config::Hx711SckPin, aiw::config::Hx711DoutPin);
-    } else {
-      Serial.printf("hx711 no data dout=%d sck=%d\n", aiw::config::Hx711DoutPin, aiw::config::Hx711SckPin);
-    }
-  } else {
-    Serial.printf("hx711 ok dout=%d sck=%d raw=%ld\n", aiw::config::Hx711DoutPin, aiw::config::Hx711SckPin, (long)rawA);
-    if (rawA == 0) {
-      Serial.println("hx711 raw=0 (dout may be floating/shorted or wrong pins)");
-    }
-  }
-  hx711->tare(20, 200);
-  hx711->setScale(aiw::config::Hx711Scale);
+  phase = bootProfiler.begin("printer");
   if (aiw::config::PrinterTxPin >= 0 && aiw::config::PrinterRxPin >= 0) {
     printerTxPin = aiw::config::PrinterTxPin;
     printerRxPin = aiw::config::PrinterRxPin;
@@ -1316,9 +1398,43 @@ void setup() {
     printerBaud = 9600;
   }
   printerBegin();
+  bootProfiler.end(phase);
+  bootProfiler.milestone("interactive");
+}
+
+// Serial commands that touch the ADC, sampler, filter or tare state. Until pollBoot()
+// has seen the boot task finish, that state belongs to the task on the other core.
+static bool isScaleCommand(int c) {
+  return c > 0 && strchr("tTcClLCnN?!DyY#0MdeE", c) != nullptr;
+}
+
+static void pollBoot() {
+  if (scaleBootDone && !scaleBootHandled) {
+    scaleBootHandled = true;
+    bootProfiler.end(bootScalePhase);
+    if (scaleBootOk) {
+      bootTarePhase = bootProfiler.begin("tare");
+      startTare();
+    } else {
+      adc->tare(adc->averageSamples() * 4, adc->conversionTimeoutMs());
+    }
+  }
+  static bool wifiUp = false;
+  bool up = wifi.isConnected();
+  if (up != wifiUp) {
+    wifiUp = up;
+    if (up && !bootProfiler.finished(bootWifiPhase)) bootProfiler.end(bootWifiPhase);
+    Serial.printf("wifi=%s ip=%s\n", up ? "connected" : "disconnected", wifi.ip().c_str());
+    drawWifiStatus();
+  }
+  if (!bootReported && scaleBootHandled && bootProfiler.finished(bootTarePhase) && (bootProfiler.finished(bootWifiPhase) || millis() > 20000)) {
+    bootReported = true;
+    bootProfiler.report(Serial);
+  }
 }
 
 void loop() {
+  pollBoot();
   touchPolledOk = touchScreen.read(touchPolled);
   if (touchRawLogEnabled && touchPolledOk && touchPolled.touching) {
     int mx = 0;
@@ -1333,6 +1449,10 @@ void loop() {
 
   while (Serial.available() > 0) {
     int c = Serial.read();
+    if (!scaleBootHandled && isScaleCommand(c)) {
+      Serial.println("scale still booting");
+      continue;
+    }
     if (c == 'p') {
       touchRawLogEnabled = !touchRawLogEnabled;
       Serial.printf("touch raw log=%d\n", touchRawLogEnabled ? 1 : 0);
@@ -1342,7 +1462,6 @@ void loop() {
       Serial.printf("touch map mode=%u (swap=%u mx=%u my=%u)\n", (unsigned)touchMapMode, (unsigned)((touchMapMode & 0x01u) ? 1 : 0), (unsigned)((touchMapMode & 0x02u) ? 1 : 0), (unsigned)((touchMapMode & 0x04u) ? 1 : 0));
       touchCalReady = false;
       uiDirty = true;
-      if (state == AppState::InputHeight) drawHeightPicker();
     }
     if (c == 'k' || c == 'K') {
       touchCalReady = false;
@@ -1379,8 +1498,6 @@ void loop() {
       aiw::setZhRenderMode(aiw::zhRenderMode() + 1);
       Serial.printf("zh render mode=%u\n", (unsigned)aiw::zhRenderMode());
       uiDirty = true;
-      if (state == AppState::InputHeight) drawHeightPicker();
-      if (state == AppState::WaitingPayment || state == AppState::FetchingQr) drawHeaderScanPay();
     }
     if (c == 't' || c == 'T') {
       tryTareNow();
@@ -1400,16 +1517,19 @@ void loop() {
       Serial.println("calibrate 500g: place 500g after tare, wait, then press c again");
       static bool waiting = false;
       static int32_t tareOffset = 0;
+      hx711Sampler.suspend();
       if (!waiting) {
-        hx711->tare(30, 500);
-        tareOffset = hx711->offset();
+        adc->tare(adc->averageSamples() * 6, 500);
+        autoZero.reset();
+        tareOffset = adc->offset();
         waiting = true;
       } else {
-        int32_t raw = hx711->readAverage(10, 200);
+        int32_t raw = adc->readAverage(adc->averageSamples() * 2, adc->conversionTimeoutMs());
         if (raw != INT32_MIN) {
           int32_t delta = raw - tareOffset;
           float scale = (float)delta / 0.5f;
-          hx711->setScale(scale);
+          adc->setScale(scale);
+          configureWeightFilter();
           Serial.printf("calibrated: raw=%ld offset=%ld delta=%ld scale=%.3f counts/kg\n",
                         (long)raw, (long)tareOffset, (long)delta, scale);
         } else {
@@ -1417,6 +1537,232 @@ void loop() {
         }
         waiting = false;
       }
+      hx711Sampler.resume();
+    }
+    if (c == 'l' || c == 'L') {
+      aiw::Hx711SamplerStats st = hx711Sampler.stats();
+      Serial.printf("hx711 sampler running=%d samples=%lu dropped=%lu overruns=%lu timeouts=%lu read_errors=%lu queued=%lu\n", hx711Sampler.isRunning() ? 1 : 0, (unsigned long)st.samples, (unsigned long)st.dropped, (unsigned long)st.overruns, (unsigned long)st.timeouts, (unsigned long)st.readErrors, (unsigned long)st.queued);
+      if (c == 'L') hx711Sampler.resetStats();
+    }
+    if (c == 'C') {
+      captureEnabled = !captureEnabled;
+      Serial.printf("capture=%d\n", captureEnabled ? 1 : 0);
+      if (captureEnabled) {
+        Serial.printf("cap_begin,offset=%ld,scale=%.3f,avg=%d,period_us=%lu\n", (long)adc->offset(), adc->scale(), weighAverager.count(), (unsigned long)adc->conversionPeriodUs());
+      }
+    }
+    if (c == 'n') {
+      size_t n = sizeof(StableWindowLengths) / sizeof(StableWindowLengths[0]);
+      size_t i = 0;
+      while (i < n && StableWindowLengths[i] != stableWindowLength) i++;
+      stableWindowLength = StableWindowLengths[(i + 1) % n];
+      configureWeightFilter();
+      payTrigger.reset();
+      Serial.printf("stability mode=%s window=%u\n", stableWindowLength ? "window" : "slope", (unsigned)weightFilter.config().stableWindow);
+    }
+    if (c == 'N') {
+      const auto &w = weightFilter.window();
+      Serial.printf("stability window len=%u count=%u mean=%ld min=%ld max=%ld range=%ld var=%lld hits=%u\n", (unsigned)w.length(), (unsigned)w.count(), (long)w.mean(), (long)w.min(), (long)w.max(), (long)w.range(), (long long)w.variance(), (unsigned)weightFilter.stableHits());
+      const aiw::SettlingEstimate &est = weightFilter.settlingEstimate();
+      Serial.printf("estimators=%s settle valid=%d confident=%d value=%ld bound=%ld\n", EstimatorModeNames[estimatorMode], est.valid ? 1 : 0, est.confident ? 1 : 0, (long)est.value, (long)est.bound);
+      const aiw::SwayEstimate &sway = weightFilter.swayEstimate();
+      Serial.printf("sway periodic=%d confident=%d freq=%.1fHz amp=%ld mean=%ld bound=%ld\n", sway.periodic ? 1 : 0, sway.confident ? 1 : 0, sway.frequencyHz, (long)sway.amplitude, (long)sway.mean, (long)sway.bound);
+    }
+    if (c == '?') {
+      logNoiseFloor("stats");
+    }
+    if (c == '!') {
+      clearNoiseFloor();
+      configureWeightFilter();
+      logNoiseFloor("cleared");
+    }
+    if (c == 'D') {
+      estimatorMode = (uint8_t)((estimatorMode + 1) % 3);
+      configureWeightFilter();
+      payTrigger.reset();
+      Serial.printf("estimators=%s\n", EstimatorModeNames[estimatorMode]);
+    }
+    if (c == 'y') {
+      // Channel A only: B32 reads a different input, so the A calibration cannot carry over.
+      int prev = adc->pgaGain();
+      int next = prev == 128 ? 64 : 128;
+      hx711Sampler.suspend();
+      adc->setPgaGain(next);
+      adc->setScale(adc->scale() * (float)next / (float)prev);
+      hx711Sampler.resume();
+      configureWeightFilter();
+      resetWeighSamples();
+      payTrigger.reset();
+      startTare();
+      Serial.printf("hx711 gain=%d scale=%.3f offset=%ld\n", adc->pgaGain(), adc->scale(), (long)adc->offset());
+    }
+    if (c == 'Y') {
+      if (!adc->hasRateControl()) {
+        Serial.println("hx711 rate pin not wired (AIW_HX711_RATE_PIN)");
+      } else {
+        bool ok = hx711Sampler.end();
+        if (ok) {
+          adc->setRateSps(adc->rateSps() == 80 ? 10 : 80);
+          ok = hx711Sampler.begin(*adc);
+        }
+        weighAverager.setCount(weighAverageSamples());
+        configureWeightFilter();
+        resetWeighSamples();
+        payTrigger.reset();
+        startTare();
+        Serial.printf("hx711 rate=%dsps sampler=%d avg=%d\n", adc->rateSps(), ok ? 1 : 0, weighAverager.count());
+      }
+    }
+    if (c == '1') {
+      bootProfiler.report(Serial);
+    }
+    if (c == '#') {
+      setWeighProfile((aiw::WeighProfileId)(((uint8_t)weighProfileId + 1) % aiw::WeighProfileCount));
+    }
+    if (c == '0') {
+      autoZero.setEnabled(!autoZero.enabled());
+      logAutoZero("toggle");
+    }
+    if (c == 'M') {
+      logAutoZero("stats");
+      const aiw::HampelFilter &hf = weightFilter.spikeFilter();
+      Serial.printf("spike filter len=%d min=%ld held=%lu spikes=%lu steps=%lu\n", hf.length(), (long)hf.minCounts(), (unsigned long)hf.held(), (unsigned long)hf.spikes(), (unsigned long)hf.steps());
+    }
+    if (c == 'd') {
+      if (!hx711ArrayActive) {
+        Serial.println("hx711 array not configured (AIW_HX711_DOUT2_PIN..4)");
+      } else {
+        Serial.printf("hx711 array ready_mask=0x%lx scale=%.3f\n", (unsigned long)hx711Array.readyMask(), hx711Array.scale());
+        for (int ch = 0; ch < hx711Array.channelCount(); ++ch) {
+          Serial.printf("  ch%d dout=%d raw=%ld offset=%ld delta=%ld scale=%.4f\n", ch, hx711Array.doutPin(ch), (long)hx711Array.lastRaw(ch), (long)hx711Array.channelOffset(ch), (long)(hx711Array.lastRaw(ch) - hx711Array.channelOffset(ch)), hx711Array.channelScale(ch));
+        }
+      }
+    }
+    if ((c == 'e' || c == 'E') && hx711ArrayActive) {
+      Serial.println("hx711 read mode switch n/a for hx711 array");
+    } else if (c == 'e') {
+      Serial.println("hx711 read bench: start");
+      hx711Sampler.suspend();
+      const aiw::Hx711ReadMode modes[] = {aiw::Hx711ReadMode::BitBang, aiw::Hx711ReadMode::Spi};
+      for (size_t i = 0; i < sizeof(modes) / sizeof(modes[0]); ++i) {
+        aiw::Hx711BenchResult r;
+        if (!aiw::runHx711ReadBench(*hx711, modes[i], 50, aiw::GlitchDelta, r)) {
+          Serial.printf("  %s: unavailable\n", aiw::hx711ReadModeName(modes[i]));
+          continue;
+        }
+        Serial.printf("  %s: reads=%d timeouts=%d read_us min=%lu avg=%lu max=%lu glitches=%d (%.1f%%)\n", aiw::hx711ReadModeName(modes[i]), r.reads, r.timeouts, (unsigned long)r.minUs, (unsigned long)r.avgUs, (unsigned long)r.maxUs, r.glitches, r.reads > 1 ? 100.0f * (float)r.glitches / (float)(r.reads - 1) : 0.0f);
+      }
+      hx711Sampler.resume();
+      Serial.println("hx711 read bench: done");
+    } else if (c == 'E') {
+      hx711Sampler.suspend();
+      aiw::Hx711ReadMode next = hx711->readMode() == aiw::Hx711ReadMode::Spi ? aiw::Hx711ReadMode::BitBang : aiw::Hx711ReadMode::Spi;
+      bool ok = hx711->setReadMode(next);
+      hx711Sampler.resume();
+      Serial.printf("hx711 read mode=%s ok=%d\n", aiw::hx711ReadModeName(hx711->readMode()), ok ? 1 : 0);
+    }
+    if (c == '@') {
+      struct BenchCase {
+        aiw::DisplayBusMode mode;
+        uint32_t hz;
+      };
+      // The first case is the original 10 MHz blocking driver; watch the panel for
+      // corruption at 80 MHz, which is above the ST7789's rated write clock.
+      static const BenchCase cases[] = {
+          {aiw::DisplayBusMode::Blocking, 10000000},
+          {aiw::DisplayBusMode::Blocking, 40000000},
+          {aiw::DisplayBusMode::Dma, 40000000},
+          {aiw::DisplayBusMode::Dma, 80000000},
+      };
+      Serial.println("display fill bench: start");
+      for (size_t i = 0; i < sizeof(cases) / sizeof(cases[0]); ++i) {
+        aiw::DisplayBenchResult r;
+        const char *mode = aiw::displayBusModeName(cases[i].mode);
+        unsigned long mhz = (unsigned long)(cases[i].hz / 1000000u);
+        if (!aiw::runDisplayFillBench(display, cases[i].mode, cases[i].hz, 8, r)) {
+          Serial.printf("  %s@%luMHz: unavailable\n", mode, mhz);
+          continue;
+        }
+        Serial.printf("  %s@%luMHz: fills=%d fill_us min=%lu avg=%lu max=%lu cpu_busy=%.1f%%\n", mode, mhz, r.fills, (unsigned long)r.minUs, (unsigned long)r.avgUs, (unsigned long)r.maxUs, r.busyPct);
+      }
+      Serial.printf("display fill bench: done bus=%s clock=%luHz\n", aiw::displayBusModeName(display.busMode()), (unsigned long)display.clockHz());
+      uiDirty = true;
+    }
+    if (c == '%') {
+      const aiw::DisplayBusMode modes[] = {aiw::DisplayBusMode::Blocking, aiw::DisplayBusMode::Dma};
+      aiw::DisplayBusMode prevMode = display.busMode();
+      Serial.printf("display pixel bench: start clock=%luHz\n", (unsigned long)display.clockHz());
+      for (size_t i = 0; i < sizeof(modes) / sizeof(modes[0]); ++i) {
+        if (!display.setBusMode(modes[i])) {
+          Serial.printf("  %s: unavailable\n", aiw::displayBusModeName(modes[i]));
+          continue;
+        }
+        for (int batched = 0; batched < 2; ++batched) {
+          aiw::DisplayPixelBenchResult r;
+          aiw::runDisplayPixelBench(display, batched != 0, 1024, r);
+          Serial.printf("  %s %s: calls=%d walk_ns=%lu repeat_ns=%lu\n", aiw::displayBusModeName(modes[i]), batched ? "batched" : "per-byte", r.calls, (unsigned long)r.walkNs, (unsigned long)r.repeatNs);
+        }
+        uint32_t t0 = micros();
+        showScreen(screens.payScreen);
+        uint32_t payUs = micros() - t0;
+        t0 = micros();
+        showScreen(screens.weighScreen);
+        Serial.printf("  %s screens: pay_us=%lu weigh_us=%lu\n", aiw::displayBusModeName(modes[i]), (unsigned long)payUs, (unsigned long)(micros() - t0));
+      }
+      display.setBusMode(prevMode);
+      Serial.println("display pixel bench: done");
+      uiDirty = true;
+    }
+    if (c == '^') {
+      const aiw::DisplayFlushStats &fs = display.flushStats();
+      unsigned long avg = fs.frames ? (unsigned long)(fs.flushedBytes / fs.frames) : 0;
+      float saved = fs.drawnBytes ? 100.0f * (1.0f - (float)fs.flushedBytes / (float)fs.drawnBytes) : 0.0f;
+      Serial.printf("display framebuffer=%d frames=%lu bytes/frame avg=%lu last=%lu max=%lu last_tiles=%u drawn=%llu flushed=%llu saved=%.1f%%\n", display.framebuffer() ? 1 : 0, (unsigned long)fs.frames, avg, (unsigned long)fs.lastFrameBytes, (unsigned long)fs.maxFrameBytes, (unsigned)fs.lastFrameTiles, (unsigned long long)fs.drawnBytes, (unsigned long long)fs.flushedBytes, saved);
+      display.resetFlushStats();
+    }
+    if (c == '&') {
+      bool ok = display.setFramebuffer(!display.framebuffer());
+      Serial.printf("display framebuffer=%d ok=%d\n", display.framebuffer() ? 1 : 0, ok ? 1 : 0);
+      uiDirty = true;
+    }
+    if (c == '*') {
+      bool prev = screens.snapshots();
+      Serial.printf("screen transition bench: start bus=%s framebuffer=%d\n", aiw::displayBusModeName(display.busMode()), display.framebuffer() ? 1 : 0);
+      for (int snap = 0; snap < 2; ++snap) {
+        screens.setSnapshots(snap != 0);
+        // Each transition starts from a different screen, as in normal use.
+        showScreen(screens.payScreen);
+        uint32_t t0 = micros();
+        showScreen(screens.heightScreen);
+        uint32_t heightUs = micros() - t0;
+        t0 = micros();
+        showScreen(screens.weighScreen);
+        uint32_t weighUs = micros() - t0;
+        t0 = micros();
+        showScreen(screens.payScreen);
+        uint32_t payUs = micros() - t0;
+        Serial.printf("  %s: height_us=%lu weigh_us=%lu pay_us=%lu\n", snap ? "snapshot" : "primitives", (unsigned long)heightUs, (unsigned long)weighUs, (unsigned long)payUs);
+      }
+      screens.setSnapshots(prev);
+      Serial.printf("screen transition bench: done snapshots=%d\n", prev ? 1 : 0);
+      uiDirty = true;
+    }
+    if (c == '~') {
+      Serial.println("widget frames:");
+      for (int i = 0; i < aiw::AppScreens::Count; ++i) {
+        const aiw::WidgetFrameStats &st = screens.all[i]->stats();
+        uint64_t fullPixels = (uint64_t)st.frames * ScreenW * ScreenH;
+        unsigned long avg = st.frames ? (unsigned long)(st.totalUs / st.frames) : 0;
+        float saved = fullPixels ? 100.0f * (1.0f - (float)st.pixels / (float)fullPixels) : 0.0f;
+        Serial.printf("  %s: frames=%lu full=%lu widgets=%lu frame_us avg=%lu last=%lu max=%lu pixels=%llu saved=%.1f%%\n", aiw::AppScreens::name(i), (unsigned long)st.frames, (unsigned long)st.fullFrames, (unsigned long)st.widgets, avg, (unsigned long)st.lastUs, (unsigned long)st.maxUs, (unsigned long long)st.pixels, saved);
+        screens.all[i]->resetStats();
+      }
+    }
+    if (c == '(') {
+      static bool fullRepaint = false;
+      fullRepaint = !fullRepaint;
+      screens.setFullRepaint(fullRepaint);
+      Serial.printf("widget full repaint=%d\n", fullRepaint ? 1 : 0);
     }
     if (c == 's' || c == 'S') {
       Serial.println("printer: selftest");
@@ -1773,6 +2119,11 @@ void loop() {
 
   gacha.loop();
 
+  if (scaleBootHandled) {
+    pollTareTimeout();
+    if (state != AppState::Weighing) drainScaleSamples();
+  }
+
   if (state == AppState::InputHeight) {
     if (uiDirty) {
       uiDirty = false;
@@ -1964,19 +2315,28 @@ void loop() {
     uint32_t now = millis();
     if (now - lastWifiRetry > 10000) {
       lastWifiRetry = now;
-      wifi.connect(aiw::config::WifiSsid, aiw::config::WifiPassword, 8000);
-      drawWifiStatus();
+      wifi.startConnect(aiw::config::WifiSsid, aiw::config::WifiPassword);
     }
   }
 
   if (state == AppState::Weighing) {
+    if (!scaleBootHandled) {
+      delay(5);
+      return;
+    }
     if (uiDirty) {
       uiDirty = false;
       uiTouchPrev = false;
-      stableHoldStartMs = 0;
-      drawUiFrame();
-      drawWeighFooter();
+      payTrigger.reset();
+      resetWeighSamples();
+      showScreen(screens.weighScreen);
       drawStatusBar(ColorBlue);
+      tareUiDirty = true;
+    }
+    if (tareUiDirty) {
+      tareUiDirty = false;
+      updateTareStatus();
+      renderScreen();
     }
 
     bool touching = false;
@@ -1991,10 +2351,10 @@ void loop() {
     touchBtn.update(shortPress, longPress);
     if (shortPress) {
       tryTareNow();
-      stableHoldStartMs = 0;
+      payTrigger.reset();
     }
     if (longPress) {
-      stableHoldStartMs = 0;
+      payTrigger.reset();
       heightTouchPrev = false;
       setState(AppState::InputHeight);
       delay(10);
@@ -2006,9 +2366,9 @@ void loop() {
     bool holdBack = touchHoldInRect(touching, tx, ty, WeighBackX, WeighBtnY, WeighBackW, WeighBtnH, 18, nowTap, 120, weighHoldBack);
     if (holdTare) {
       tryTareNow();
-      stableHoldStartMs = 0;
+      payTrigger.reset();
     } else if (holdBack) {
-      stableHoldStartMs = 0;
+      payTrigger.reset();
       heightTouchPrev = false;
       setState(AppState::InputHeight);
       delay(10);
@@ -2022,9 +2382,9 @@ void loop() {
       bool inBack = inRectPad(tapX, tapY, WeighBackX, WeighBtnY, WeighBackW, WeighBtnH, 14) || inRectPad(uiTouchStartX, uiTouchStartY, WeighBackX, WeighBtnY, WeighBackW, WeighBtnH, 14);
       if (inTare) {
           tryTareNow();
-          stableHoldStartMs = 0;
+          payTrigger.reset();
       } else if (inBack) {
-        stableHoldStartMs = 0;
+        payTrigger.reset();
         heightTouchPrev = false;
         setState(AppState::InputHeight);
         delay(10);
@@ -2032,123 +2392,50 @@ void loop() {
       }
     }
 
-    int32_t raw = hx711->readAverage(3, 120);
-    if (raw == INT32_MIN) {
+    int32_t raw = 0;
+    if (!takeWeighSample(raw)) {
       uint32_t now = millis();
-      if (now - lastHx711LogMs > 1000) {
+      if (now - lastWeighSampleMs > 1000 && now - lastHx711LogMs > 1000) {
         lastHx711LogMs = now;
-        Serial.printf("hx711 timeout dout=%d sck=%d\n", hx711 == &hx711A ? aiw::config::Hx711DoutPin : aiw::config::Hx711SckPin, hx711 == &hx711A ? aiw::config::Hx711SckPin : aiw::config::Hx711DoutPin);
+        if (hx711ArrayActive) {
+          Serial.printf("hx711 array timeout ready_mask=0x%lx\n", (unsigned long)hx711Array.readyMask());
+        } else {
+          Serial.printf("hx711 timeout dout=%d sck=%d\n", hx711 == &hx711A ? aiw::config::Hx711DoutPin : aiw::config::Hx711SckPin, hx711 == &hx711A ? aiw::config::Hx711SckPin : aiw::config::Hx711DoutPin);
+        }
         drawStatusBar(ColorRed);
       }
-      delay(100);
+      delay(5);
       return;
     }
 
-    int32_t delta = raw - hx711->offset();
-    float w = (float)delta / hx711->scale();
-
-    if (hasLastDelta) {
-      int32_t diff = delta - lastDelta;
-      if (diff < 0) diff = -diff;
-      if (diff > 2000) {
-        glitchCount++;
-        resetDeltaWindow();
-        lastDelta = delta;
-        filteredInit = false;
-        hasLastFilteredDelta = false;
-        uint32_t now = millis();
-        if (now - lastHx711LogMs > 1000) {
-          lastHx711LogMs = now;
-          Serial.printf("hx711 jump raw=%ld delta=%ld last=%ld diff=%ld reset=%lu\n", (long)raw, (long)delta, (long)lastDelta, (long)diff, (unsigned long)glitchCount);
-        }
-      }
-    }
-    hasLastDelta = true;
-    lastDelta = delta;
-
-    pushDelta(delta);
-    if (!filteredInit) {
-      filteredDelta = (float)delta;
-      filteredInit = true;
-    } else {
-      filteredDelta = filteredDelta + 0.25f * ((float)delta - filteredDelta);
-    }
-
-    int32_t displayDelta = (int32_t)lroundf(filteredDelta);
-    int32_t absDisplayDelta = displayDelta < 0 ? -displayDelta : displayDelta;
-    if (absDisplayDelta < ZeroSnapDelta) displayDelta = 0;
-    float displayWeight = (float)displayDelta / hx711->scale();
-    float quantizedWeight = quantize(displayWeight, DisplayStep);
-    if (hasLastShownWeight) {
-      if (fabsf(quantizedWeight - lastShownWeight) < DisplayHysteresis) {
-        quantizedWeight = lastShownWeight;
-      }
-    }
-
-    bool stableNow = false;
-    int32_t diffDisplay = 0;
-    int32_t stableThreshold = 0;
-    if (hasLastFilteredDelta) {
-      diffDisplay = displayDelta - lastFilteredDelta;
-      if (diffDisplay < 0) diffDisplay = -diffDisplay;
-      stableThreshold = 120 + absDisplayDelta / 500;
-      if (stableThreshold > 500) stableThreshold = 500;
-      stableNow = diffDisplay <= stableThreshold;
-    }
-    hasLastFilteredDelta = true;
-    lastFilteredDelta = displayDelta;
-
-    if (stableNow) {
-      if (stableHits < 255) stableHits++;
-    } else {
-      stableHits = 0;
-    }
-    bool stable = stableHits >= 6;
-    float shownWeight = quantizedWeight;
-    if (stable) {
-      if (!displayLocked) {
-        displayLocked = true;
-        lockedWeight = quantizedWeight;
-      }
-      shownWeight = lockedWeight;
-    } else if (displayLocked) {
-      if (fabsf(quantizedWeight - lockedWeight) > StableUnlockDelta) {
-        displayLocked = false;
-      } else {
-        shownWeight = lockedWeight;
+    int32_t delta = raw - adc->offset();
+    aiw::FilterOutput fo = weightFilter.push(delta);
+    if (fo.glitch || fo.step) {
+      uint32_t now = millis();
+      if (now - lastHx711LogMs > 1000) {
+        lastHx711LogMs = now;
+        Serial.printf("hx711 %s raw=%ld delta=%ld spikes=%lu steps=%lu\n", fo.step ? "step" : "hold", (long)raw, (long)delta, (unsigned long)weightFilter.glitchCount(), (unsigned long)weightFilter.stepCount());
       }
     }
-    hasLastShownWeight = true;
+    bool stable = fo.stable;
+    float shownWeight = (float)fo.display * activeProfile().stepKg;
     lastShownWeight = shownWeight;
     drawWeight(stable, shownWeight);
 
-    if (!stable) {
-      stableHoldStartMs = 0;
+    bool fire = false;
+    if (wifi.isConnected()) {
+      fire = payTrigger.update(fo, millis());
+    } else {
+      payTrigger.reset();
     }
-    if (stable && wifi.isConnected()) {
-      if (absDisplayDelta < PayTriggerDelta) {
-        stableHoldStartMs = 0;
-        delay(100);
-        return;
-      }
-      if (stableHoldStartMs == 0) {
-        stableHoldStartMs = millis();
-        drawStatusBar(ColorBlue);
-      }
-      if (millis() - stableHoldStartMs < 900) {
-        delay(60);
-        return;
-      }
-      stableHoldStartMs = 0;
+    if (fire) {
       lastStableWeight = shownWeight;
       drawStatusBar(ColorBlue);
       Serial.printf("trigger pay: weight=%.2f height=%.0f\n", lastStableWeight, lastInputHeightCm);
       setState(AppState::CreatingPayment);
-    } else if (!wifi.isConnected()) {
-      stableHoldStartMs = 0;
     }
 
-    delay(100);
+    delay(5);
     return;
   }
 
@@ -2156,8 +2443,7 @@ void loop() {
     if (uiDirty) {
       uiDirty = false;
       uiTouchPrev = false;
-      drawUiFrame();
-      drawHeaderLabel("PAY");
+      showStatus("PAY");
       drawStatusBar(ColorBlue);
     }
     Serial.printf("pay create: weight=%.2f height=%.0f\n", lastStableWeight, lastInputHeightCm);
@@ -2189,11 +2475,9 @@ void loop() {
     if (uiDirty) {
       uiDirty = false;
       uiTouchPrev = false;
-      drawUiFrame();
-      drawHeaderScanPay();
+      screens.qrView.setMatrix(nullptr);
+      showScreen(screens.payScreen);
       drawStatusBar(ColorBlue);
-      drawPayFooter();
-      clearQrArea();
     }
     aiw::QrMatrix m;
     bool ok = qrClient.fetchMatrixText(payCreateRes.codeUrl.c_str(), m);
@@ -2205,19 +2489,15 @@ void loop() {
       return;
     }
     qrMatrix = m;
-    int qx = 0;
-    int qy = 0;
-    int qs = 0;
-    qrLayout(qx, qy, qs);
-    display.beginWrite();
-    bool drawn = qrRenderer.drawMatrix(qrMatrix, qx, qy, qs, ColorBlack, ColorWhite);
-    display.endWrite();
-    Serial.printf("qr draw ok=%d size=%d\n", drawn ? 1 : 0, qrMatrix.size);
+    screens.qrView.setMatrix(&qrMatrix);
+    renderScreen();
+    Serial.printf("qr draw ok=%d size=%d\n", screens.qrView.drawn() ? 1 : 0, qrMatrix.size);
     drawStatusBar(ColorBlue);
-    drawPayFooter();
     lastPollMs = 0;
     paidHandled = false;
     setState(AppState::WaitingPayment);
+    // The pay screen is complete; only a later invalidation repaints it.
+    uiDirty = false;
     return;
   }
 
@@ -2225,9 +2505,8 @@ void loop() {
     if (uiDirty) {
       uiDirty = false;
       uiTouchPrev = false;
-      drawHeaderScanPay();
+      showScreen(screens.payScreen);
       drawStatusBar(ColorBlue);
-      drawPayFooter();
     }
 
     bool touching = false;
@@ -2282,7 +2561,8 @@ void loop() {
     if (ok && qres.success) {
       gacha.trigger();
       setState(AppState::Paid);
-      drawUiFrame();
+      screens.statusLabel.setText("");
+      showScreen(screens.statusScreen);
       drawStatusBar(ColorGreen);
       drawWeight(true, lastStableWeight);
       return;
@@ -2293,8 +2573,7 @@ void loop() {
   if (state == AppState::Paid) {
     if (paidHandled) return;
     paidHandled = true;
-    drawUiFrame();
-    drawHeaderLabel("RESULT");
+    showStatus("RESULT");
     drawStatusBar(ColorGreen);
     rewardStartMs = millis();
     rewardAi = aiw::AiWithTtsResult{};
@@ -2303,7 +2582,8 @@ void loop() {
 
     bool audioStarted = false;
     if (rewardAiOk) {
-      drawHeaderLabel("PRINT AUDIO");
+      screens.statusLabel.setText("PRINT AUDIO");
+      renderScreen();
       if (rewardAi.audioUrl.length()) {
         audioStarted = audioPlayer.playWavAsync(aiw::config::BackendBaseUrl, rewardAi.audioUrl);
       } else {
@@ -2358,11 +2638,10 @@ void loop() {
     while (audioStarted && audioPlayer.isPlaying() && (millis() - audioWaitStart < 25000)) {
       delay(10);
     }
-    stableHoldStartMs = 0;
+    payTrigger.reset();
     heightTouchPrev = false;
 
-    drawUiFrame();
-    drawHeaderLabel("DONE");
+    showStatus("DONE");
     drawStatusBar(ColorGreen);
     setState(AppState::InputHeight);
     delay(1000);
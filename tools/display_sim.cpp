@@ -0,0 +1,277 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/stat.h>
+
+#include <chrono>
+#include <functional>
+#include <string>
+#include <vector>
+
+#include "app/app_config.h"
+#include "app/app_screens.h"
+#include "app/display_st7789.h"
+#include "app/qr_renderer.h"
+#include "app/seven_seg.h"
+#include "app/text_draw.h"
+#include "host_bus.h"
+#include "st7789_sim.h"
+
+// Runs the firmware's display code against a simulated ST7789 (tools/host): boot, the
+// height picker, the weighing readouts, the pay QR code, a status screen and the glyph
+// renderers, once per bus configuration. Every step prints the SPI traffic the panel
+// saw and an estimate of its wire time; the panel images must come out the same in
+// every configuration. By default they are compared with the golden PNGs in
+// tools/golden, so rendering changes show up as image diffs; --out rewrites the PNGs
+// after an intended change.
+
+using aiw::ui::ColorBlack;
+using aiw::ui::ColorBlue;
+using aiw::ui::ColorWhite;
+
+static const aiw::DisplayPins Pins = {6, 7, 5, 4, 48, 45, 47};
+
+struct BusConfig {
+  const char *name;
+  aiw::DisplayBusMode mode;
+  bool framebuffer;
+  bool batchedAddr;
+};
+
+static const BusConfig Configs[] = {
+    {"blocking", aiw::DisplayBusMode::Blocking, false, true},
+    {"dma", aiw::DisplayBusMode::Dma, false, true},
+    {"blocking+fb", aiw::DisplayBusMode::Blocking, true, true},
+    {"dma+fb", aiw::DisplayBusMode::Dma, true, true},
+    {"unbatched", aiw::DisplayBusMode::Blocking, false, false},
+};
+
+struct Step {
+  const char *name;
+  std::function<void()> run;
+};
+
+struct StepResult {
+  aiw::St7789SimStats stats;
+  double hostUs = 0.0;
+  std::vector<uint16_t> image;
+};
+
+static double nowUs() {
+  return (double)std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count() / 1000.0;
+}
+
+// Deterministic stand-in for a payment code: version 3 size, random modules.
+static aiw::QrMatrix testMatrix() {
+  aiw::QrMatrix m;
+  m.size = 29;
+  std::string rows;
+  uint32_t seed = 12345;
+  for (int y = 0; y < m.size; ++y) {
+    for (int x = 0; x < m.size; ++x) {
+      seed = seed * 1664525u + 1013904223u;
+      rows += (seed >> 31) ? '1' : '0';
+    }
+    rows += '\n';
+  }
+  m.rows = String(rows);
+  return m;
+}
+
+static bool readFile(const std::string &path, std::vector<uint8_t> &out) {
+  FILE *f = fopen(path.c_str(), "rb");
+  if (!f) return false;
+  uint8_t buf[4096];
+  size_t n;
+  while ((n = fread(buf, 1, sizeof(buf), f)) > 0) out.insert(out.end(), buf, buf + n);
+  fclose(f);
+  return true;
+}
+
+static void runConfig(const BusConfig &cfg, uint32_t clockHz, std::vector<std::string> &names, std::vector<StepResult> &results) {
+  aiw::St7789Sim panel;
+  aiw::host::attachPanel(&panel, Pins.cs, Pins.dc);
+  aiw::DisplaySt7789 display(Pins);
+  aiw::SevenSeg seg(display);
+  aiw::QrRenderer qr(display);
+  aiw::AppScreens screens(seg, qr, 170);
+  aiw::QrMatrix matrix = testMatrix();
+
+  auto show = [&](aiw::WidgetScreen &s) {
+    s.invalidate();
+    s.render(display);
+  };
+  const Step steps[] = {
+      {"boot",
+       [&] {
+         display.setClockHz(clockHz);
+         display.setBusMode(cfg.mode);
+         display.setBatchedAddr(cfg.batchedAddr);
+         display.begin();
+         display.setFramebuffer(cfg.framebuffer);
+       }},
+      {"height", [&] { show(screens.heightScreen); }},
+      {"height_171",
+       [&] {
+         screens.setHeight(171);
+         screens.heightScreen.render(display);
+       }},
+      {"height_220",
+       [&] {
+         screens.setHeight(220);
+         screens.heightScreen.render(display);
+       }},
+      {"weigh",
+       [&] {
+         screens.setReadouts("170", "0.0");
+         show(screens.weighScreen);
+       }},
+      {"weigh_72.4",
+       [&] {
+         screens.setReadouts("170", "72.4");
+         screens.weighScreen.render(display);
+       }},
+      {"weigh_72.5",
+       [&] {
+         screens.setReadouts("170", "72.5");
+         screens.weighScreen.render(display);
+       }},
+      {"tare_bar",
+       [&] {
+         screens.tareButton.setBar(56, ColorBlue);
+         screens.weighScreen.render(display);
+       }},
+      {"pay_qr",
+       [&] {
+         screens.qrView.setMatrix(&matrix);
+         show(screens.payScreen);
+       }},
+      {"status",
+       [&] {
+         screens.statusLabel.setText("RESULT");
+         screens.setReadouts("", "");
+         show(screens.statusScreen);
+       }},
+      {"glyphs",
+       [&] {
+         display.beginWrite();
+         display.clear(ColorWhite);
+         aiw::drawText5x7(display, 8, 8, "0123456789 ABC xyz", ColorBlack, ColorWhite, 1);
+         aiw::drawText5x7(display, 8, 24, "72.5 kg", ColorBlack, ColorWhite, 2);
+         aiw::drawText5x7(display, 8, 48, "BMI 23.4", ColorBlack, ColorWhite, 3);
+         aiw::drawZhText16(display, 8, 84, aiw::ui::kZhTare, ColorBlack, ColorWhite);
+         aiw::drawZhText16(display, 48, 84, aiw::ui::kZhNext, ColorBlack, ColorWhite);
+         aiw::drawZhText28(display, 8, 110, aiw::ui::kZhSelectHeight, ColorBlack, ColorWhite);
+         aiw::drawZhText28(display, 8, 150, aiw::ui::kZhScanPay, ColorBlack, ColorWhite);
+         display.endWrite();
+       }},
+  };
+
+  names.clear();
+  results.clear();
+  for (const Step &step : steps) {
+    double t0 = nowUs();
+    step.run();
+    display.flush();
+    StepResult r;
+    r.hostUs = nowUs() - t0;
+    r.stats = panel.frame();
+    panel.endFrame();
+    r.image.assign(panel.pixels(), panel.pixels() + aiw::St7789Sim::Width * aiw::St7789Sim::Height);
+    names.push_back(step.name);
+    results.push_back(r);
+  }
+  aiw::host::attachPanel(nullptr, -1, -1);
+}
+
+static constexpr const char *GoldenDir = "tools/golden";
+
+static void usage() {
+  fprintf(stderr, "usage: display_sim [--out dir] [--check dir] [--clock hz]\n");
+  fprintf(stderr, "  --out    write a PNG of the panel after every step into dir\n");
+  fprintf(stderr, "  --check  compare with the PNGs an earlier --out wrote to dir (default %s)\n", GoldenDir);
+  fprintf(stderr, "  --clock  SPI clock for the wire-time estimate (default %lu)\n", (unsigned long)aiw::config::DisplaySpiHz);
+}
+
+int main(int argc, char **argv) {
+  const char *outDir = nullptr;
+  const char *checkDir = nullptr;
+  uint32_t clockHz = aiw::config::DisplaySpiHz;
+  for (int i = 1; i < argc; ++i) {
+    if (!strcmp(argv[i], "--out") && i + 1 < argc) {
+      outDir = argv[++i];
+    } else if (!strcmp(argv[i], "--check") && i + 1 < argc) {
+      checkDir = argv[++i];
+    } else if (!strcmp(argv[i], "--clock") && i + 1 < argc) {
+      clockHz = (uint32_t)strtoul(argv[++i], nullptr, 10);
+    } else {
+      usage();
+      return 2;
+    }
+  }
+  if (clockHz == 0) {
+    usage();
+    return 2;
+  }
+  if (!outDir && !checkDir) checkDir = GoldenDir;
+
+  int failures = 0;
+  std::vector<std::string> names;
+  std::vector<StepResult> reference;
+  for (const BusConfig &cfg : Configs) {
+    std::vector<StepResult> results;
+    runConfig(cfg, clockHz, names, results);
+    printf("%s @ %.1f MHz\n", cfg.name, clockHz / 1e6);
+    for (size_t i = 0; i < results.size(); ++i) {
+      const aiw::St7789SimStats &s = results[i].stats;
+      double wireUs = (double)s.bytes() * 8.0 * 1e6 / (double)clockHz;
+      printf("  %-11s cs=%-6u cmds=%-6u windows=%-6u caset=%-6u raset=%-6u params=%-7llu pixel_bytes=%-7llu stray=%llu wire_us=%.0f host_us=%.0f\n", names[i].c_str(), s.csToggles, s.commands, s.windows, s.casets, s.rasets, (unsigned long long)s.paramBytes, (unsigned long long)s.pixelBytes, (unsigned long long)s.strayBytes, wireUs, results[i].hostUs);
+      if (s.strayBytes) failures++;
+    }
+    if (reference.empty()) {
+      reference = results;
+      continue;
+    }
+    for (size_t i = 0; i < results.size(); ++i) {
+      size_t diff = 0;
+      for (size_t k = 0; k < results[i].image.size(); ++k) diff += results[i].image[k] != reference[i].image[k];
+      if (diff) {
+        printf("  %s: %zu pixels differ from %s\n", names[i].c_str(), diff, Configs[0].name);
+        failures++;
+      }
+    }
+  }
+
+  const char *dir = outDir ? outDir : checkDir;
+  if (outDir) mkdir(outDir, 0755);
+  for (size_t i = 0; i < reference.size(); ++i) {
+    const uint16_t *image = reference[i].image.data();
+    std::string path = std::string(dir) + "/" + names[i] + ".png";
+    if (outDir) {
+      if (!aiw::St7789Sim::writePng(path.c_str(), image)) {
+        fprintf(stderr, "cannot write %s\n", path.c_str());
+        return 1;
+      }
+      continue;
+    }
+    // The encoder is deterministic, so equal files mean equal pixels.
+    std::string tmp = path + ".new";
+    std::vector<uint8_t> want;
+    std::vector<uint8_t> got;
+    if (!readFile(path, want)) {
+      printf("golden %s: missing\n", path.c_str());
+      failures++;
+      continue;
+    }
+    aiw::St7789Sim::writePng(tmp.c_str(), image);
+    readFile(tmp, got);
+    if (got != want) {
+      printf("golden %s: differs, new image in %s\n", path.c_str(), tmp.c_str());
+      failures++;
+    } else {
+      remove(tmp.c_str());
+    }
+  }
+  if (failures) printf("%d failures\n", failures);
+  return failures ? 1 : 0;
+}
@@ -0,0 +1,50 @@
+#pragma once
+
+// Just enough of the Arduino core to build the display code on the host; see host_bus.h.
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#include <string>
+
+#define IRAM_ATTR
+#define LOW 0
+#define HIGH 1
+#define INPUT 0
+#define OUTPUT 1
+#define MSBFIRST 1
+#define SPI_MODE0 0
+
+void pinMode(int pin, int mode);
+void digitalWrite(int pin, int level);
+void delay(uint32_t ms);
+void delayMicroseconds(uint32_t us);
+uint32_t millis();
+uint32_t micros();
+
+class String {
+public:
+  String() = default;
+  String(const char *s) : s_(s ? s : "") {}
+  String(const std::string &s) : s_(s) {}
+  const char *c_str() const { return s_.c_str(); }
+  unsigned int length() const { return (unsigned int)s_.size(); }
+  char operator[](unsigned int i) const { return i < s_.size() ? s_[i] : '\0'; }
+  int indexOf(char c, unsigned int from = 0) const {
+    size_t p = s_.find(c, from);
+    return p == std::string::npos ? -1 : (int)p;
+  }
+  String &operator+=(const String &o) {
+    s_ += o.s_;
+    return *this;
+  }
+  String &operator+=(char c) {
+    s_ += c;
+    return *this;
+  }
+  bool operator==(const String &o) const { return s_ == o.s_; }
+
+private:
+  std::string s_;
+};
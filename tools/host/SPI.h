@@ -0,0 +1,24 @@
+#pragma once
+
+#include <Arduino.h>
+
+struct SPISettings {
+  SPISettings(uint32_t clock, int bitOrder, int dataMode) : clockHz(clock) {
+    (void)bitOrder;
+    (void)dataMode;
+  }
+  uint32_t clockHz;
+};
+
+// Bytes go to the simulated panel; CS and DC are whatever the GPIOs were set to.
+class SPIClass {
+public:
+  void begin(int sclk, int miso, int mosi, int ss);
+  void end();
+  void beginTransaction(SPISettings settings);
+  void endTransaction();
+  void write(uint8_t b);
+  void writeBytes(const uint8_t *data, size_t len);
+};
+
+extern SPIClass SPI;
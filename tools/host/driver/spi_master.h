@@ -0,0 +1,67 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+// The subset of the IDF spi_master API the display driver uses. Transactions are
+// delivered to the simulated panel when queued; results come back in queue order.
+
+typedef int esp_err_t;
+#define ESP_OK 0
+#define ESP_FAIL -1
+
+typedef int spi_host_device_t;
+#define SPI2_HOST 1
+#define SPI3_HOST 2
+#define SPI_DMA_CH_AUTO 3
+
+typedef int gpio_num_t;
+
+#define portMAX_DELAY 0xFFFFFFFFu
+
+#define SPI_DEVICE_NO_DUMMY (1u << 6)
+#define SPI_TRANS_USE_TXDATA (1u << 3)
+#define SPI_TRANS_CS_KEEP_ACTIVE (1u << 8)
+
+struct spi_transaction_t {
+  uint32_t flags;
+  size_t length;
+  size_t rxlength;
+  void *user;
+  const void *tx_buffer;
+  void *rx_buffer;
+  uint8_t tx_data[4];
+};
+
+typedef void (*transaction_cb_t)(spi_transaction_t *trans);
+
+struct spi_bus_config_t {
+  int mosi_io_num;
+  int miso_io_num;
+  int sclk_io_num;
+  int quadwp_io_num;
+  int quadhd_io_num;
+  int max_transfer_sz;
+};
+
+struct spi_device_interface_config_t {
+  uint8_t mode;
+  int clock_speed_hz;
+  int spics_io_num;
+  uint32_t flags;
+  int queue_size;
+  transaction_cb_t pre_cb;
+};
+
+typedef struct HostSpiDevice *spi_device_handle_t;
+
+esp_err_t spi_bus_initialize(spi_host_device_t host, const spi_bus_config_t *config, int dmaChan);
+esp_err_t spi_bus_free(spi_host_device_t host);
+esp_err_t spi_bus_add_device(spi_host_device_t host, const spi_device_interface_config_t *config, spi_device_handle_t *handle);
+esp_err_t spi_bus_remove_device(spi_device_handle_t handle);
+esp_err_t spi_device_polling_transmit(spi_device_handle_t handle, spi_transaction_t *trans);
+esp_err_t spi_device_queue_trans(spi_device_handle_t handle, spi_transaction_t *trans, uint32_t ticks);
+esp_err_t spi_device_get_trans_result(spi_device_handle_t handle, spi_transaction_t **trans, uint32_t ticks);
+esp_err_t spi_device_acquire_bus(spi_device_handle_t handle, uint32_t ticks);
+void spi_device_release_bus(spi_device_handle_t handle);
+void gpio_reset_pin(gpio_num_t pin);
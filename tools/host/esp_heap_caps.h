@@ -0,0 +1,8 @@
+#pragma once
+
+#include <stddef.h>
+
+#define MALLOC_CAP_DMA (1u << 3)
+#define MALLOC_CAP_SPIRAM (1u << 10)
+
+void *heap_caps_malloc(size_t size, unsigned int caps);
@@ -0,0 +1,183 @@
+#include "host_bus.h"
+
+#include <Arduino.h>
+#include <SPI.h>
+#include <driver/spi_master.h>
+#include <esp_heap_caps.h>
+#include <esp_timer.h>
+#include <soc/gpio_struct.h>
+#include <stdlib.h>
+
+#include <chrono>
+#include <deque>
+
+SPIClass SPI;
+gpio_dev_t GPIO;
+
+struct HostSpiDevice {
+  spi_device_interface_config_t config;
+  std::deque<spi_transaction_t *> done;
+};
+
+namespace aiw {
+namespace host {
+
+static St7789Sim *panel = nullptr;
+static int csPin = -1;
+static int dcPin = -1;
+
+void attachPanel(St7789Sim *p, int cs, int dc) {
+  panel = p;
+  csPin = cs;
+  dcPin = dc;
+}
+
+static void setPin(int pin, bool level) {
+  if (!panel) return;
+  if (pin == csPin) panel->setCs(level);
+  if (pin == dcPin) panel->setDc(level);
+}
+
+static void send(const uint8_t *data, size_t len) {
+  if (panel && len) panel->write(data, len);
+}
+
+// CS is driven by the controller around each transaction, DC by the pre-callback.
+static void transmit(HostSpiDevice *dev, spi_transaction_t *t) {
+  if (dev->config.pre_cb) dev->config.pre_cb(t);
+  setPin(dev->config.spics_io_num, false);
+  const uint8_t *data = (t->flags & SPI_TRANS_USE_TXDATA) ? t->tx_data : (const uint8_t *)t->tx_buffer;
+  send(data, t->length / 8);
+  if (!(t->flags & SPI_TRANS_CS_KEEP_ACTIVE)) setPin(dev->config.spics_io_num, true);
+}
+
+}  // namespace host
+}  // namespace aiw
+
+using namespace aiw::host;
+
+GpioSetReg &GpioSetReg::operator=(uint32_t mask) {
+  for (int bit = 0; bit < 32; ++bit) {
+    if (mask & (1u << bit)) setPin((int)base + bit, level);
+  }
+  return *this;
+}
+
+void pinMode(int pin, int mode) {
+  (void)pin;
+  (void)mode;
+}
+
+void digitalWrite(int pin, int level) {
+  setPin(pin, level != LOW);
+}
+
+void delay(uint32_t ms) {
+  (void)ms;
+}
+
+void delayMicroseconds(uint32_t us) {
+  (void)us;
+}
+
+int64_t esp_timer_get_time() {
+  using namespace std::chrono;
+  return (int64_t)duration_cast<microseconds>(steady_clock::now().time_since_epoch()).count();
+}
+
+uint32_t millis() {
+  return (uint32_t)(esp_timer_get_time() / 1000);
+}
+
+uint32_t micros() {
+  return (uint32_t)esp_timer_get_time();
+}
+
+void *heap_caps_malloc(size_t size, unsigned int caps) {
+  (void)caps;
+  return malloc(size);
+}
+
+void SPIClass::begin(int sclk, int miso, int mosi, int ss) {
+  (void)sclk;
+  (void)miso;
+  (void)mosi;
+  (void)ss;
+}
+
+void SPIClass::end() {}
+
+void SPIClass::beginTransaction(SPISettings settings) {
+  (void)settings;
+}
+
+void SPIClass::endTransaction() {}
+
+void SPIClass::write(uint8_t b) {
+  send(&b, 1);
+}
+
+void SPIClass::writeBytes(const uint8_t *data, size_t len) {
+  send(data, len);
+}
+
+esp_err_t spi_bus_initialize(spi_host_device_t host, const spi_bus_config_t *config, int dmaChan) {
+  (void)host;
+  (void)config;
+  (void)dmaChan;
+  return ESP_OK;
+}
+
+esp_err_t spi_bus_free(spi_host_device_t host) {
+  (void)host;
+  return ESP_OK;
+}
+
+esp_err_t spi_bus_add_device(spi_host_device_t host, const spi_device_interface_config_t *config, spi_device_handle_t *handle) {
+  (void)host;
+  HostSpiDevice *dev = new HostSpiDevice();
+  dev->config = *config;
+  setPin(config->spics_io_num, true);
+  *handle = dev;
+  return ESP_OK;
+}
+
+esp_err_t spi_bus_remove_device(spi_device_handle_t handle) {
+  delete handle;
+  return ESP_OK;
+}
+
+esp_err_t spi_device_polling_transmit(spi_device_handle_t handle, spi_transaction_t *trans) {
+  transmit(handle, trans);
+  return ESP_OK;
+}
+
+esp_err_t spi_device_queue_trans(spi_device_handle_t handle, spi_transaction_t *trans, uint32_t ticks) {
+  (void)ticks;
+  transmit(handle, trans);
+  handle->done.push_back(trans);
+  return ESP_OK;
+}
+
+esp_err_t spi_device_get_trans_result(spi_device_handle_t handle, spi_transaction_t **trans, uint32_t ticks) {
+  (void)ticks;
+  if (handle->done.empty()) return ESP_FAIL;
+  *trans = handle->done.front();
+  handle->done.pop_front();
+  return ESP_OK;
+}
+
+esp_err_t spi_device_acquire_bus(spi_device_handle_t handle, uint32_t ticks) {
+  (void)handle;
+  (void)ticks;
+  return ESP_OK;
+}
+
+// A transaction that kept CS asserted is closed when the bus is released.
+void spi_device_release_bus(spi_device_handle_t handle) {
+  setPin(handle->config.spics_io_num, true);
+}
+
+void gpio_reset_pin(gpio_num_t pin) {
+  (void)pin;
+}
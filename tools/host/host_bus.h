@@ -0,0 +1,14 @@
+#pragma once
+
+#include "st7789_sim.h"
+
+// Host builds of DisplaySt7789 (tools/host on the include path) talk to a simulated
+// panel: SPI writes, IDF spi_master transactions and the CS/DC GPIOs all end up in the
+// attached St7789Sim. delay() returns at once; micros() is the host's steady clock.
+namespace aiw {
+namespace host {
+
+void attachPanel(St7789Sim *panel, int csPin, int dcPin);
+
+}  // namespace host
+}  // namespace aiw
@@ -0,0 +1,23 @@
+#pragma once
+
+#include <stdint.h>
+
+// Writes to the set/clear registers reach the simulated panel's CS and DC lines.
+struct GpioSetReg {
+  GpioSetReg &operator=(uint32_t mask);
+  uint32_t base;
+  bool level;
+};
+
+struct GpioSetReg32 {
+  GpioSetReg val;
+};
+
+struct gpio_dev_t {
+  GpioSetReg out_w1ts{0, true};
+  GpioSetReg out_w1tc{0, false};
+  GpioSetReg32 out1_w1ts{{32, true}};
+  GpioSetReg32 out1_w1tc{{32, false}};
+};
+
+extern gpio_dev_t GPIO;
@@ -0,0 +1,328 @@
+#include "st7789_sim.h"
+
+#include <stdio.h>
+#include <string.h>
+
+#include <vector>
+
+namespace aiw {
+
+static constexpr uint8_t CmdSwreset = 0x01;
+static constexpr uint8_t CmdSlpin = 0x10;
+static constexpr uint8_t CmdSlpout = 0x11;
+static constexpr uint8_t CmdDispoff = 0x28;
+static constexpr uint8_t CmdDispon = 0x29;
+static constexpr uint8_t CmdCaset = 0x2A;
+static constexpr uint8_t CmdRaset = 0x2B;
+static constexpr uint8_t CmdRamwr = 0x2C;
+static constexpr uint8_t CmdMadctl = 0x36;
+static constexpr uint8_t CmdColmod = 0x3A;
+static constexpr uint8_t CmdRamwrc = 0x3C;
+
+St7789Sim::St7789Sim() {
+  reset();
+}
+
+void St7789Sim::reset() {
+  memset(mem_, 0, sizeof(mem_));
+  cs_ = true;
+  dc_ = true;
+  haveCmd_ = false;
+  paramCount_ = 0;
+  colStart_ = 0;
+  colEnd_ = Width - 1;
+  rowStart_ = 0;
+  rowEnd_ = Height - 1;
+  curX_ = 0;
+  curY_ = 0;
+  pending_ = -1;
+  displayOn_ = false;
+  sleeping_ = true;
+  madctl_ = 0;
+  colmod_ = 0;
+  frame_ = St7789SimStats();
+  total_ = St7789SimStats();
+}
+
+void St7789Sim::setCs(bool high) {
+  if (!high && cs_) frame_.csToggles++;
+  // The interface drops a half-sent pixel when CS goes high.
+  if (high) pending_ = -1;
+  cs_ = high;
+}
+
+void St7789Sim::setDc(bool high) {
+  dc_ = high;
+}
+
+void St7789Sim::write(const uint8_t *bytes, size_t len) {
+  if (cs_) {
+    frame_.strayBytes += len;
+    return;
+  }
+  if (!dc_) {
+    for (size_t i = 0; i < len; ++i) command(bytes[i]);
+    return;
+  }
+  if (haveCmd_ && (cmd_ == CmdRamwr || cmd_ == CmdRamwrc)) {
+    frame_.pixelBytes += len;
+    for (size_t i = 0; i < len; ++i) pixelByte(bytes[i]);
+    return;
+  }
+  for (size_t i = 0; i < len; ++i) param(bytes[i]);
+}
+
+void St7789Sim::command(uint8_t c) {
+  frame_.commands++;
+  cmd_ = c;
+  haveCmd_ = true;
+  paramCount_ = 0;
+  pending_ = -1;
+  switch (c) {
+    case CmdSwreset:
+      displayOn_ = false;
+      sleeping_ = true;
+      madctl_ = 0;
+      break;
+    case CmdSlpin:
+      sleeping_ = true;
+      break;
+    case CmdSlpout:
+      sleeping_ = false;
+      break;
+    case CmdDispoff:
+      displayOn_ = false;
+      break;
+    case CmdDispon:
+      displayOn_ = true;
+      break;
+    case CmdCaset:
+      frame_.casets++;
+      break;
+    case CmdRaset:
+      frame_.rasets++;
+      break;
+    case CmdRamwr:
+      frame_.windows++;
+      curX_ = colStart_;
+      curY_ = rowStart_;
+      break;
+    default:
+      break;
+  }
+}
+
+void St7789Sim::param(uint8_t b) {
+  if (!haveCmd_) {
+    frame_.strayBytes++;
+    return;
+  }
+  frame_.paramBytes++;
+  if (paramCount_ < sizeof(params_)) params_[paramCount_] = b;
+  paramCount_++;
+  if (cmd_ == CmdMadctl && paramCount_ == 1) madctl_ = b;
+  if (cmd_ == CmdColmod && paramCount_ == 1) colmod_ = b;
+  if (paramCount_ != 4) return;
+  uint16_t start = (uint16_t)((params_[0] << 8) | params_[1]);
+  uint16_t end = (uint16_t)((params_[2] << 8) | params_[3]);
+  if (cmd_ == CmdCaset) {
+    colStart_ = start;
+    colEnd_ = end;
+  } else if (cmd_ == CmdRaset) {
+    rowStart_ = start;
+    rowEnd_ = end;
+  }
+}
+
+// Pixels off the panel are dropped but still advance the pointer.
+void St7789Sim::pixelByte(uint8_t b) {
+  if (pending_ < 0) {
+    pending_ = b;
+    return;
+  }
+  uint16_t color = (uint16_t)((pending_ << 8) | b);
+  pending_ = -1;
+  if (curX_ < Width && curY_ < Height) mem_[curY_ * Width + curX_] = color;
+  if (curX_ >= colEnd_) {
+    curX_ = colStart_;
+    curY_ = curY_ >= rowEnd_ ? rowStart_ : (uint16_t)(curY_ + 1);
+  } else {
+    curX_++;
+  }
+}
+
+static void addStats(St7789SimStats &to, const St7789SimStats &from) {
+  to.csToggles += from.csToggles;
+  to.commands += from.commands;
+  to.casets += from.casets;
+  to.rasets += from.rasets;
+  to.windows += from.windows;
+  to.paramBytes += from.paramBytes;
+  to.pixelBytes += from.pixelBytes;
+  to.strayBytes += from.strayBytes;
+}
+
+void St7789Sim::endFrame() {
+  addStats(total_, frame_);
+  frame_ = St7789SimStats();
+}
+
+static uint32_t crc32(uint32_t crc, const uint8_t *p, size_t n) {
+  static uint32_t table[256];
+  static bool ready = false;
+  if (!ready) {
+    for (uint32_t i = 0; i < 256; ++i) {
+      uint32_t c = i;
+      for (int k = 0; k < 8; ++k) c = (c & 1u) ? 0xEDB88320u ^ (c >> 1) : c >> 1;
+      table[i] = c;
+    }
+    ready = true;
+  }
+  crc = ~crc;
+  for (size_t i = 0; i < n; ++i) crc = table[(crc ^ p[i]) & 0xFFu] ^ (crc >> 8);
+  return ~crc;
+}
+
+static void put32(std::vector<uint8_t> &out, uint32_t v) {
+  out.push_back((uint8_t)(v >> 24));
+  out.push_back((uint8_t)(v >> 16));
+  out.push_back((uint8_t)(v >> 8));
+  out.push_back((uint8_t)v);
+}
+
+static void putChunk(std::vector<uint8_t> &out, const char *type, const std::vector<uint8_t> &data) {
+  put32(out, (uint32_t)data.size());
+  size_t start = out.size();
+  out.insert(out.end(), type, type + 4);
+  out.insert(out.end(), data.begin(), data.end());
+  put32(out, crc32(0, &out[start], out.size() - start));
+}
+
+// LSB-first bit writer for deflate; Huffman codes go in most significant bit first.
+struct BitWriter {
+  std::vector<uint8_t> &out;
+  uint32_t acc = 0;
+  int bits = 0;
+
+  void put(uint32_t v, int n) {
+    acc |= v << bits;
+    bits += n;
+    while (bits >= 8) {
+      out.push_back((uint8_t)acc);
+      acc >>= 8;
+      bits -= 8;
+    }
+  }
+  void putCode(uint32_t code, int n) {
+    uint32_t r = 0;
+    for (int i = 0; i < n; ++i) r |= ((code >> i) & 1u) << (n - 1 - i);
+    put(r, n);
+  }
+  void flush() {
+    if (bits > 0) out.push_back((uint8_t)acc);
+    acc = 0;
+    bits = 0;
+  }
+};
+
+static void putLiteral(BitWriter &w, int v) {
+  if (v < 144) {
+    w.putCode(0x30 + v, 8);
+  } else if (v < 256) {
+    w.putCode(0x190 + v - 144, 9);
+  } else if (v < 280) {
+    w.putCode(v - 256, 7);
+  } else {
+    w.putCode(0xC0 + v - 280, 8);
+  }
+}
+
+static void putMatch(BitWriter &w, int length, int distance) {
+  static constexpr uint16_t LenBase[] = {3, 4, 5, 6, 7, 8, 9, 10, 11, 13, 15, 17, 19, 23, 27, 31, 35, 43, 51, 59, 67, 83, 99, 115, 131, 163, 195, 227, 258};
+  static constexpr uint8_t LenExtra[] = {0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 2, 2, 2, 2, 3, 3, 3, 3, 4, 4, 4, 4, 5, 5, 5, 5, 0};
+  static constexpr uint16_t DistBase[] = {1, 2, 3, 4, 5, 7, 9, 13, 17, 25, 33, 49, 65, 97, 129, 193, 257, 385, 513, 769, 1025, 1537, 2049, 3073, 4097, 6145, 8193, 12289, 16385, 24577};
+  static constexpr uint8_t DistExtra[] = {0, 0, 0, 0, 1, 1, 2, 2, 3, 3, 4, 4, 5, 5, 6, 6, 7, 7, 8, 8, 9, 9, 10, 10, 11, 11, 12, 12, 13, 13};
+  int l = 28;
+  while (LenBase[l] > length) --l;
+  putLiteral(w, 257 + l);
+  w.put((uint32_t)(length - LenBase[l]), LenExtra[l]);
+  int d = 29;
+  while (DistBase[d] > distance) --d;
+  w.putCode((uint32_t)d, 5);
+  w.put((uint32_t)(distance - DistBase[d]), DistExtra[d]);
+}
+
+// Panel images are mostly flat fills, so matching only the previous pixel and the row
+// above (stride bytes back) gets most of what a full LZ77 search would.
+static void deflateFixed(const std::vector<uint8_t> &raw, int stride, std::vector<uint8_t> &out) {
+  BitWriter w{out};
+  w.put(1, 1);
+  w.put(1, 2);
+  size_t n = raw.size();
+  for (size_t i = 0; i < n;) {
+    int bestLen = 0;
+    int bestDist = 0;
+    for (int dist : {3, stride}) {
+      if (i < (size_t)dist) continue;
+      int len = 0;
+      while (len < 258 && i + len < n && raw[i + len] == raw[i + len - dist]) ++len;
+      if (len > bestLen) {
+        bestLen = len;
+        bestDist = dist;
+      }
+    }
+    if (bestLen >= 3) {
+      putMatch(w, bestLen, bestDist);
+      i += (size_t)bestLen;
+    } else {
+      putLiteral(w, raw[i]);
+      ++i;
+    }
+  }
+  putLiteral(w, 256);
+  w.flush();
+}
+
+bool St7789Sim::writePng(const char *path, const uint16_t *pixels) {
+  std::vector<uint8_t> raw;
+  raw.reserve((size_t)Height * (1 + Width * 3));
+  for (int y = 0; y < Height; ++y) {
+    raw.push_back(0);
+    for (int x = 0; x < Width; ++x) {
+      uint16_t c = pixels[y * Width + x];
+      uint8_t r = (uint8_t)((c >> 11) & 0x1F);
+      uint8_t g = (uint8_t)((c >> 5) & 0x3F);
+      uint8_t b = (uint8_t)(c & 0x1F);
+      raw.push_back((uint8_t)((r << 3) | (r >> 2)));
+      raw.push_back((uint8_t)((g << 2) | (g >> 4)));
+      raw.push_back((uint8_t)((b << 3) | (b >> 2)));
+    }
+  }
+
+  // zlib stream of one fixed-Huffman block, then the Adler-32 of the raw rows.
+  std::vector<uint8_t> z = {0x78, 0x01};
+  deflateFixed(raw, Width * 3 + 1, z);
+  uint32_t a = 1;
+  uint32_t b = 0;
+  for (uint8_t v : raw) {
+    a = (a + v) % 65521u;
+    b = (b + a) % 65521u;
+  }
+  put32(z, (b << 16) | a);
+
+  std::vector<uint8_t> png = {0x89, 'P', 'N', 'G', '\r', '\n', 0x1A, '\n'};
+  std::vector<uint8_t> ihdr;
+  put32(ihdr, Width);
+  put32(ihdr, Height);
+  ihdr.insert(ihdr.end(), {8, 2, 0, 0, 0});
+  putChunk(png, "IHDR", ihdr);
+  putChunk(png, "IDAT", z);
+  putChunk(png, "IEND", {});
+
+  FILE *f = fopen(path, "wb");
+  if (!f) return false;
+  bool ok = fwrite(png.data(), 1, png.size(), f) == png.size();
+  return fclose(f) == 0 && ok;
+}
+
+}  // namespace aiw
@@ -0,0 +1,86 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+namespace aiw {
+
+struct St7789SimStats {
+  // CS falling edges, i.e. SPI transactions as the panel sees them.
+  uint32_t csToggles = 0;
+  uint32_t commands = 0;
+  uint32_t casets = 0;
+  uint32_t rasets = 0;
+  // RAMWR commands: every window setup ends with one.
+  uint32_t windows = 0;
+  uint64_t paramBytes = 0;
+  uint64_t pixelBytes = 0;
+  // Clocked with CS high, or data with no command to take it; a driver bug if nonzero.
+  uint64_t strayBytes = 0;
+
+  uint64_t bytes() const { return commands + paramBytes + pixelBytes + strayBytes; }
+};
+
+// Host model of the panel end of the SPI bus: decodes the byte stream the driver sends
+// (DC low for commands, CASET/RASET windows, RAMWR pixel data in big-endian RGB565)
+// into a 320x240 RGB565 memory. The write pointer wraps inside the window as on the
+// ST7789, and RAMWR data may continue across CS cycles until the next command.
+// Addresses are taken as screen coordinates; MADCTL is recorded, not applied.
+class St7789Sim {
+public:
+  static constexpr int Width = 320;
+  static constexpr int Height = 240;
+
+  St7789Sim();
+
+  void reset();
+  void setCs(bool high);
+  void setDc(bool high);
+  void write(const uint8_t *bytes, size_t len);
+  void write(uint8_t byte) { write(&byte, 1); }
+
+  // Controller memory, RGB565 in host order, row-major.
+  const uint16_t *pixels() const { return mem_; }
+  uint16_t pixel(int x, int y) const { return mem_[y * Width + x]; }
+  bool displayOn() const { return displayOn_; }
+  bool sleeping() const { return sleeping_; }
+  uint8_t madctl() const { return madctl_; }
+  uint8_t colmod() const { return colmod_; }
+
+  // Counters since the last endFrame(); endFrame() adds them to the totals.
+  const St7789SimStats &frame() const { return frame_; }
+  const St7789SimStats &total() const { return total_; }
+  void endFrame();
+
+  // 8-bit RGB PNG of the controller memory (stored deflate blocks, no zlib needed).
+  bool writePng(const char *path) const { return writePng(path, mem_); }
+  static bool writePng(const char *path, const uint16_t *pixels);
+
+private:
+  void command(uint8_t c);
+  void param(uint8_t b);
+  void pixelByte(uint8_t b);
+
+  uint16_t mem_[Width * Height];
+  bool cs_ = true;
+  bool dc_ = true;
+  uint8_t cmd_ = 0;
+  bool haveCmd_ = false;
+  uint8_t params_[4] = {};
+  size_t paramCount_ = 0;
+  uint16_t colStart_ = 0;
+  uint16_t colEnd_ = Width - 1;
+  uint16_t rowStart_ = 0;
+  uint16_t rowEnd_ = Height - 1;
+  uint16_t curX_ = 0;
+  uint16_t curY_ = 0;
+  int pending_ = -1;
+  bool displayOn_ = false;
+  bool sleeping_ = true;
+  uint8_t madctl_ = 0;
+  uint8_t colmod_ = 0;
+  St7789SimStats frame_;
+  St7789SimStats total_;
+};
+
+}  // namespace aiw
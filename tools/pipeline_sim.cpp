@@ -0,0 +1,315 @@
+#include <math.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <algorithm>
+#include <chrono>
+#include <vector>
+
+#include "app/async_tare.h"
+#include "app/auto_zero.h"
+#include "app/noise_floor.h"
+#include "app/simulated_adc.h"
+#include "app/weigh_pipeline.h"
+#include "app/weigh_profile.h"
+#include "app/weight_filter.h"
+
+// Drives the whole weighing chain of loop() from a SimulatedAdc: boot tare, auto-zero,
+// noise-floor retuning, averaging, the weight filter and the pay trigger. Scenarios are
+// synthesized from a seed, so every run is reproducible; --trace replays a capture
+// ("cap,<t_us>,<raw>,...") through the same chain instead.
+
+
+enum class Scenario : uint8_t { Person = 0, Parcel = 1 };
+
+struct SimOptions {
+  Scenario scenario = Scenario::Person;
+  aiw::WeighProfileId profile = aiw::WeighProfileId::Person;
+  bool allProfiles = false;
+  int sessions = 20;
+  int rateSps = 10;
+  float noiseCounts = 60.0f;
+  float spikeRate = 0.0f;
+  float driftCountsPerMin = 0.0f;
+  float countsPerKg = 20000.0f;
+  uint32_t seed = 1;
+  const char *trace = nullptr;
+  bool verbose = false;
+};
+
+struct SimResult {
+  int rateSps = 0;
+  uint32_t conversions = 0;
+  uint64_t simulatedMs = 0;
+  double hostNsPerConversion = 0.0;
+  int sessions = 0;
+  int triggers = 0;
+  int falseTriggers = 0;
+  int untriggered = 0;
+  std::vector<float> latencyMs;
+  std::vector<float> errorKg;
+  uint32_t spikes = 0;
+  uint32_t retunes = 0;
+  bool tared = false;
+};
+
+static uint32_t xorshift(uint32_t &s) {
+  s ^= s << 13;
+  s ^= s >> 17;
+  s ^= s << 5;
+  return s;
+}
+
+static float uniform(uint32_t &s, float lo, float hi) {
+  return lo + (hi - lo) * (float)(xorshift(s) >> 8) / 16777216.0f;
+}
+
+// Each session: empty platform, step on, stand or rest, step off.
+static std::vector<aiw::SimulatedLoad> makeScenario(const SimOptions &opt) {
+  std::vector<aiw::SimulatedLoad> loads;
+  uint32_t s = opt.seed * 2654435761u + 1u;
+  // Leave the boot tare an empty platform, as on the device.
+  uint32_t t = 6000;
+  for (int i = 0; i < opt.sessions; ++i) {
+    t += 3000 + (uint32_t)uniform(s, 0.0f, 2000.0f);
+    aiw::SimulatedLoad on{t, 0.0f, 0.0f, 0.0f};
+    uint32_t hold;
+    if (opt.scenario == Scenario::Person) {
+      on.kg = uniform(s, 40.0f, 100.0f);
+      // About a third of people sway noticeably while they stand.
+      if (xorshift(s) % 3 == 0) {
+        on.swayKg = uniform(s, 0.2f, 1.0f);
+        on.swayHz = uniform(s, 0.6f, 1.5f);
+      }
+      hold = 7000 + (uint32_t)uniform(s, 0.0f, 3000.0f);
+    } else {
+      on.kg = uniform(s, 0.3f, 5.0f);
+      hold = 6000 + (uint32_t)uniform(s, 0.0f, 2000.0f);
+    }
+    loads.push_back(on);
+    t += hold;
+    loads.push_back(aiw::SimulatedLoad{t, 0.0f, 0.0f, 0.0f});
+  }
+  loads.push_back(aiw::SimulatedLoad{t + 3000, 0.0f, 0.0f, 0.0f});
+  return loads;
+}
+
+static bool loadTrace(const char *path, std::vector<int32_t> &raw, int &rateSps) {
+  FILE *f = fopen(path, "r");
+  if (!f) return false;
+  char line[256];
+  uint64_t firstUs = 0;
+  uint64_t lastUs = 0;
+  while (fgets(line, sizeof(line), f)) {
+    const char *p = strstr(line, "cap,");
+    unsigned long tUs = 0;
+    long v = 0;
+    if (!p || sscanf(p, "cap,%lu,%ld", &tUs, &v) != 2) continue;
+    if (raw.empty()) firstUs = tUs;
+    lastUs = tUs;
+    raw.push_back((int32_t)v);
+  }
+  fclose(f);
+  if (raw.size() > 1 && lastUs > firstUs) {
+    float sps = (float)(raw.size() - 1) * 1e6f / (float)(lastUs - firstUs);
+    rateSps = sps >= 40.0f ? 80 : 10;
+  }
+  return true;
+}
+
+static float median(std::vector<float> v) {
+  if (v.empty()) return 0.0f;
+  std::sort(v.begin(), v.end());
+  return v[v.size() / 2];
+}
+
+static float percentile(std::vector<float> v, float p) {
+  if (v.empty()) return 0.0f;
+  std::sort(v.begin(), v.end());
+  size_t i = (size_t)(p * (float)(v.size() - 1) + 0.5f);
+  return v[i];
+}
+
+static SimResult simulate(const SimOptions &opt, const aiw::WeighProfile &profile) {
+  SimResult r;
+  aiw::SimulatedAdcConfig acfg;
+  acfg.countsPerKg = opt.countsPerKg;
+  acfg.noiseCounts = opt.noiseCounts;
+  acfg.spikeRate = opt.spikeRate;
+  acfg.driftCountsPerMin = opt.driftCountsPerMin;
+  acfg.seed = opt.seed;
+  aiw::SimulatedAdc adc(acfg);
+
+  std::vector<aiw::SimulatedLoad> loads;
+  std::vector<int32_t> traceRaw;
+  int rate = profile.rateSps ? profile.rateSps : opt.rateSps;
+  if (opt.trace) {
+    if (!loadTrace(opt.trace, traceRaw, rate)) {
+      fprintf(stderr, "%s: cannot open\n", opt.trace);
+      return r;
+    }
+    adc.setTrace(traceRaw.data(), traceRaw.size());
+  } else {
+    loads = makeScenario(opt);
+    adc.setLoads(loads.data(), loads.size());
+  }
+  adc.setRateSps(rate);
+  adc.setScale(opt.countsPerKg);
+  adc.begin();
+
+  r.rateSps = adc.rateSps();
+  int avgCount = aiw::weighProfileAverage(profile, adc.rateSps());
+  aiw::NoiseFloorEstimator noiseFloor;
+  noiseFloor.configure(aiw::PayTriggerDelta / 2);
+  aiw::NoiseThresholds th = aiw::fallbackNoiseThresholds();
+  auto filterConfig = [&]() {
+    aiw::WeightFilterConfig cfg = aiw::makeWeighProfileConfig(profile, adc.scale(), adc.rateSps());
+    aiw::applyFilterThresholds(cfg, th);
+    return cfg;
+  };
+  aiw::WeightFilter<aiw::StableWindowCapacity> filter(filterConfig());
+  aiw::SampleAverager averager(avgCount);
+  aiw::PayTrigger payTrigger;
+  aiw::applyTriggerThresholds(th, profile.holdMs, payTrigger, noiseFloor);
+  aiw::AutoZeroTracker autoZero;
+  autoZero.configure(aiw::makeAutoZeroConfig(adc.scale(), profile.stepKg));
+
+  aiw::AsyncTare tare;
+  int32_t motion = (int32_t)(adc.scale() * profile.stepKg * (float)aiw::TareMotionSteps + 0.5f);
+  if (motion < 100) motion = 100;
+  tare.start(adc.averageSamples() * 6, motion, aiw::TareMaxAttempts);
+
+  float lastLoad = 0.0f;
+  uint64_t sessionStartMs = 0;
+  bool paid = true;
+  uint64_t endUs = loads.empty() ? 0 : (uint64_t)loads.back().atMs * 1000u;
+  auto t0 = std::chrono::steady_clock::now();
+  while (adc.isReady() && (opt.trace || adc.nowUs() < endUs)) {
+    int32_t raw = adc.readConversion();
+    if (raw == INT32_MIN) continue;
+    uint64_t nowMs = adc.nowUs() / 1000u;
+    if (!opt.trace && adc.loadKg() != lastLoad) {
+      if (!paid && lastLoad > 0.0f) r.untriggered++;
+      lastLoad = adc.loadKg();
+      paid = lastLoad <= 0.0f;
+      if (!paid) {
+        r.sessions++;
+        sessionStartMs = nowMs;
+      }
+    }
+    if (tare.busy()) {
+      if (tare.push(raw)) {
+        if (tare.state() == aiw::TareState::Done) {
+          adc.setOffset(tare.offset());
+          r.tared = true;
+        } else {
+          // Like pressing tare again after a rejected attempt.
+          tare.start(adc.averageSamples() * 6, motion, aiw::TareMaxAttempts);
+        }
+      }
+      continue;
+    }
+    int32_t zeroStep = 0;
+    if (autoZero.push(raw - adc.offset(), (uint32_t)nowMs, zeroStep)) adc.setOffset(adc.offset() + zeroStep);
+    if (noiseFloor.push(raw - adc.offset())) {
+      aiw::NoiseThresholds next = aiw::currentNoiseThresholds(noiseFloor, avgCount, adc.scale(), profile.stepKg);
+      if (aiw::noiseThresholdsDiffer(next, th)) {
+        th = next;
+        aiw::applyTriggerThresholds(th, profile.holdMs, payTrigger, noiseFloor);
+        filter.configure(filterConfig());
+        r.retunes++;
+      }
+    }
+    int32_t avg = 0;
+    if (!averager.push(raw, avg)) continue;
+    aiw::FilterOutput fo = filter.push(avg - adc.offset());
+    if (!payTrigger.update(fo, (uint32_t)nowMs)) continue;
+    float kg = (float)fo.display * profile.stepKg;
+    if (opt.trace) {
+      r.triggers++;
+      if (opt.verbose) printf("  trigger t=%llums weight=%.2f\n", (unsigned long long)nowMs, kg);
+      continue;
+    }
+    if (paid) continue;
+    // The firmware leaves the weighing screen here; one trigger per session.
+    paid = true;
+    r.triggers++;
+    float err = fabsf(kg - lastLoad);
+    r.latencyMs.push_back((float)(nowMs - sessionStartMs));
+    r.errorKg.push_back(err);
+    if (err > 2.0f * profile.stepKg) r.falseTriggers++;
+    if (opt.verbose) printf("  trigger t=%llums true=%.3f weight=%.3f latency=%llums\n", (unsigned long long)nowMs, lastLoad, kg, (unsigned long long)(nowMs - sessionStartMs));
+  }
+  auto t1 = std::chrono::steady_clock::now();
+  r.conversions = adc.conversions();
+  r.simulatedMs = adc.nowUs() / 1000u;
+  double ns = (double)std::chrono::duration_cast<std::chrono::nanoseconds>(t1 - t0).count();
+  r.hostNsPerConversion = r.conversions ? ns / (double)r.conversions : 0.0;
+  r.spikes = filter.glitchCount();
+  return r;
+}
+
+static void usage() {
+  fprintf(stderr, "usage: pipeline_sim [--scenario person|parcel] [--profile name|all] [--sessions n] [--rate sps] [--noise counts] [--spikes p] [--drift counts_per_min] [--scale counts_per_kg] [--seed n] [--trace file] [-v]\n");
+}
+
+int main(int argc, char **argv) {
+  SimOptions opt;
+  for (int i = 1; i < argc; ++i) {
+    const char *a = argv[i];
+    bool more = i + 1 < argc;
+    if (!strcmp(a, "--scenario") && more) {
+      const char *name = argv[++i];
+      if (!strcmp(name, "person")) {
+        opt.scenario = Scenario::Person;
+      } else if (!strcmp(name, "parcel")) {
+        opt.scenario = Scenario::Parcel;
+      } else {
+        usage();
+        return 2;
+      }
+    } else if (!strcmp(a, "--profile") && more) {
+      const char *name = argv[++i];
+      if (!strcmp(name, "all")) {
+        opt.allProfiles = true;
+      } else if (!aiw::weighProfileFromName(name, opt.profile)) {
+        fprintf(stderr, "unknown profile %s\n", name);
+        return 2;
+      }
+    } else if (!strcmp(a, "--sessions") && more) {
+      opt.sessions = atoi(argv[++i]);
+    } else if (!strcmp(a, "--rate") && more) {
+      opt.rateSps = atoi(argv[++i]);
+    } else if (!strcmp(a, "--noise") && more) {
+      opt.noiseCounts = (float)atof(argv[++i]);
+    } else if (!strcmp(a, "--spikes") && more) {
+      opt.spikeRate = (float)atof(argv[++i]);
+    } else if (!strcmp(a, "--drift") && more) {
+      opt.driftCountsPerMin = (float)atof(argv[++i]);
+    } else if (!strcmp(a, "--scale") && more) {
+      opt.countsPerKg = (float)atof(argv[++i]);
+    } else if (!strcmp(a, "--seed") && more) {
+      opt.seed = (uint32_t)strtoul(argv[++i], nullptr, 10);
+    } else if (!strcmp(a, "--trace") && more) {
+      opt.trace = argv[++i];
+    } else if (!strcmp(a, "-v")) {
+      opt.verbose = true;
+    } else {
+      usage();
+      return 2;
+    }
+  }
+
+  printf("%-10s %4s %7s %8s %5s %5s %5s %6s %8s %8s %8s %6s %6s %8s\n", "profile", "sps", "conv", "sim_s", "sess", "trig", "false", "untrig", "lat_ms", "p90_ms", "error_g", "spikes", "retune", "ns/conv");
+  for (int i = 0; i < aiw::WeighProfileCount; ++i) {
+    aiw::WeighProfileId id = (aiw::WeighProfileId)i;
+    if (!opt.allProfiles && id != opt.profile) continue;
+    const aiw::WeighProfile &p = aiw::weighProfile(id);
+    SimResult r = simulate(opt, p);
+    if (!r.tared) printf("%-10s tare never completed\n", p.name);
+    printf("%-10s %4d %7lu %8.1f %5d %5d %5d %6d %8.0f %8.0f %8.1f %6lu %6lu %8.1f\n", p.name, r.rateSps, (unsigned long)r.conversions, (float)r.simulatedMs / 1000.0f, r.sessions, r.triggers, r.falseTriggers, r.untriggered, median(r.latencyMs), percentile(r.latencyMs, 0.9f), median(r.errorKg) * 1000.0f, (unsigned long)r.spikes, (unsigned long)r.retunes, r.hostNsPerConversion);
+  }
+  return 0;
+}
@@ -0,0 +1,216 @@
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+#include <chrono>
+#include <vector>
+
+#include "app/display_list.h"
+#include "app/rle_image.h"
+#include "app/ui_screens.h"
+
+// Renders the static layer of each screen through the same DisplayList recipes the
+// firmware uses and writes them as palette RLE images (see rle_image.h) to
+// src/app/screen_snapshots_data.cpp. Every image is decoded again and compared with
+// the rendering before it is written. Run `make screen_snapshots` after changing the
+// layout, the buttons or the fonts.
+
+using aiw::ui::ScreenLayer;
+
+static constexpr int W = aiw::ui::ScreenW;
+static constexpr int H = aiw::ui::ScreenH;
+
+struct Piece {
+  aiw::ui::ScreenRect rect;
+  std::vector<uint16_t> palette;
+  std::vector<uint8_t> data;
+};
+
+struct LayerOut {
+  ScreenLayer layer;
+  std::vector<Piece> pieces;
+  double rasterizeUs = 0.0;
+  double decodeUs = 0.0;
+};
+
+static bool encodePiece(const std::vector<uint16_t> &screen, Piece &p) {
+  std::vector<uint16_t> px;
+  for (int r = 0; r < p.rect.h; ++r) {
+    for (int c = 0; c < p.rect.w; ++c) px.push_back(screen[(size_t)(p.rect.y + r) * W + (size_t)(p.rect.x + c)]);
+  }
+  for (size_t i = 0; i < px.size();) {
+    uint16_t color = px[i];
+    size_t idx = 0;
+    while (idx < p.palette.size() && p.palette[idx] != color) ++idx;
+    if (idx == p.palette.size()) {
+      if (p.palette.size() == 16) {
+        fprintf(stderr, "piece %d,%d %dx%d has more than 16 colours\n", p.rect.x, p.rect.y, p.rect.w, p.rect.h);
+        return false;
+      }
+      p.palette.push_back(color);
+    }
+    size_t run = 1;
+    while (i + run < px.size() && px[i + run] == color) ++run;
+    i += run;
+    if (run <= 15) {
+      p.data.push_back((uint8_t)((idx << 4) | (run - 1)));
+      continue;
+    }
+    p.data.push_back((uint8_t)((idx << 4) | 0x0Fu));
+    size_t extra = run - 16;
+    do {
+      uint8_t b = (uint8_t)(extra & 0x7Fu);
+      extra >>= 7;
+      p.data.push_back(extra ? (uint8_t)(b | 0x80u) : b);
+    } while (extra);
+  }
+  return true;
+}
+
+static aiw::RleImage imageOf(const Piece &p) {
+  aiw::RleImage img = {};
+  img.x = p.rect.x;
+  img.y = p.rect.y;
+  img.w = p.rect.w;
+  img.h = p.rect.h;
+  img.paletteSize = (uint8_t)p.palette.size();
+  img.palette = p.palette.data();
+  img.data = p.data.data();
+  img.size = (uint32_t)p.data.size();
+  return img;
+}
+
+static bool verifyPiece(const std::vector<uint16_t> &screen, const Piece &p) {
+  aiw::RleImage img = imageOf(p);
+  aiw::RleDecoder dec;
+  dec.begin(img);
+  std::vector<uint16_t> row((size_t)p.rect.w);
+  for (int r = 0; r < p.rect.h; ++r) {
+    if (dec.read(row.data(), row.size(), false) != row.size()) return false;
+    if (memcmp(row.data(), &screen[(size_t)(p.rect.y + r) * W + (size_t)p.rect.x], row.size() * 2) != 0) return false;
+  }
+  return dec.remaining() == 0;
+}
+
+static double nowUs() {
+  return (double)std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count() / 1000.0;
+}
+
+// Host CPU time to produce the layer once, rasterizing the list vs decoding the pieces.
+static void timeLayer(const aiw::DisplayList &list, LayerOut &out) {
+  const int reps = 50;
+  std::vector<uint16_t> buf((size_t)W * H);
+  double t0 = nowUs();
+  for (int i = 0; i < reps; ++i) list.rasterize(0, H, buf.data(), W, true);
+  out.rasterizeUs = (nowUs() - t0) / reps;
+  t0 = nowUs();
+  for (int i = 0; i < reps; ++i) {
+    for (const Piece &p : out.pieces) {
+      aiw::RleImage img = imageOf(p);
+      aiw::RleDecoder dec;
+      dec.begin(img);
+      while (dec.read(buf.data(), 2048, true) > 0) {
+      }
+    }
+  }
+  out.decodeUs = (nowUs() - t0) / reps;
+}
+
+static void writeSource(FILE *f, const std::vector<LayerOut> &layers) {
+  fprintf(f, "// Generated by tools/screen_snapshots.cpp (make screen_snapshots); do not edit.\n");
+  fprintf(f, "#include \"app/ui_screens.h\"\n\nnamespace aiw {\nnamespace ui {\n");
+  for (const LayerOut &l : layers) {
+    const char *name = screenLayerName(l.layer);
+    for (size_t i = 0; i < l.pieces.size(); ++i) {
+      const Piece &p = l.pieces[i];
+      fprintf(f, "\nstatic const uint16_t %s%zu_palette[%zu] = {", name, i, p.palette.size());
+      for (size_t k = 0; k < p.palette.size(); ++k) fprintf(f, "%s0x%04X", k ? ", " : "", p.palette[k]);
+      fprintf(f, "};\n\nstatic const uint8_t %s%zu_data[%zu] = {", name, i, p.data.size());
+      for (size_t k = 0; k < p.data.size(); ++k) {
+        fprintf(f, "%s0x%02X,", k % 16 == 0 ? "\n    " : " ", p.data[k]);
+      }
+      fprintf(f, "\n};\n");
+    }
+    fprintf(f, "\nstatic const RleImage %s_pieces[%zu] = {\n", name, l.pieces.size());
+    for (size_t i = 0; i < l.pieces.size(); ++i) {
+      const Piece &p = l.pieces[i];
+      fprintf(f, "    {%d, %d, %d, %d, %zu, %s%zu_palette, %s%zu_data, %zu},\n", p.rect.x, p.rect.y, p.rect.w, p.rect.h, p.palette.size(), name, i, name, i, p.data.size());
+    }
+    fprintf(f, "};\n");
+  }
+  fprintf(f, "\nconst ScreenSnapshot &screenSnapshot(ScreenLayer layer) {\n");
+  fprintf(f, "  static const ScreenSnapshot snapshots[ScreenLayerCount] = {\n");
+  for (const LayerOut &l : layers) {
+    fprintf(f, "      {%s_pieces, %zu},\n", screenLayerName(l.layer), l.pieces.size());
+  }
+  fprintf(f, "  };\n  return snapshots[(int)layer];\n}\n\n}  // namespace ui\n}  // namespace aiw\n");
+}
+
+static void usage() {
+  fprintf(stderr, "usage: screen_snapshots [--out file.cpp] [--check]\n");
+  fprintf(stderr, "  --out    where to write the generated source (default: stdout)\n");
+  fprintf(stderr, "  --check  only render, verify and print the sizes\n");
+}
+
+int main(int argc, char **argv) {
+  const char *outPath = nullptr;
+  bool check = false;
+  for (int i = 1; i < argc; ++i) {
+    if (!strcmp(argv[i], "--out") && i + 1 < argc) {
+      outPath = argv[++i];
+    } else if (!strcmp(argv[i], "--check")) {
+      check = true;
+    } else {
+      usage();
+      return 2;
+    }
+  }
+
+  std::vector<LayerOut> layers;
+  size_t totalBytes = 0;
+  for (int li = 0; li < aiw::ui::ScreenLayerCount; ++li) {
+    LayerOut out;
+    out.layer = (ScreenLayer)li;
+    aiw::DisplayList list;
+    list.begin(0, 0, W, H, aiw::ui::ColorWhite);
+    aiw::ui::addScreenLayer(out.layer, list);
+    if (list.overflowed()) {
+      fprintf(stderr, "%s: display list overflowed\n", screenLayerName(out.layer));
+      return 1;
+    }
+    std::vector<uint16_t> screen((size_t)W * H);
+    list.rasterize(0, H, screen.data(), W, false);
+
+    aiw::ui::ScreenRect rects[8];
+    size_t n = aiw::ui::screenLayerRects(out.layer, rects, 8);
+    size_t pixels = 0;
+    size_t bytes = 0;
+    for (size_t i = 0; i < n; ++i) {
+      Piece p;
+      p.rect = rects[i];
+      if (!encodePiece(screen, p)) return 1;
+      if (!verifyPiece(screen, p)) {
+        fprintf(stderr, "%s: piece %zu does not decode back\n", screenLayerName(out.layer), i);
+        return 1;
+      }
+      pixels += (size_t)p.rect.w * (size_t)p.rect.h;
+      bytes += p.data.size() + p.palette.size() * 2;
+      out.pieces.push_back(p);
+    }
+    timeLayer(list, out);
+    totalBytes += bytes;
+    fprintf(stderr, "%-6s pieces=%zu pixels=%zu raw=%zu B rle=%zu B (%.1f%%) host rasterize=%.1f us decode=%.1f us\n", screenLayerName(out.layer), n, pixels, pixels * 2, bytes, 100.0 * (double)bytes / (double)(pixels * 2), out.rasterizeUs, out.decodeUs);
+    layers.push_back(out);
+  }
+  fprintf(stderr, "total flash=%zu B\n", totalBytes);
+  if (check) return 0;
+
+  FILE *f = outPath ? fopen(outPath, "w") : stdout;
+  if (!f) {
+    fprintf(stderr, "cannot write %s\n", outPath);
+    return 1;
+  }
+  writeSource(f, layers);
+  if (outPath) fclose(f);
+  return 0;
+}
@@ -0,0 +1,93 @@
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include <chrono>
+#include <vector>
+
+#include "app/sliding_window.h"
+
+static std::vector<int32_t> makeTrace(size_t n, uint32_t seed) {
+  std::vector<int32_t> out(n);
+  uint32_t s = seed;
+  int32_t level = 0;
+  for (size_t i = 0; i < n; ++i) {
+    s = s * 1664525u + 1013904223u;
+    if (i % 4000 == 0) level = (int32_t)((s >> 8) % 120000u);
+    int32_t noise = (int32_t)((s >> 16) % 161u) - 80;
+    out[i] = level + noise;
+  }
+  return out;
+}
+
+struct NaiveWindow {
+  std::vector<int32_t> values;
+  size_t length;
+  size_t count = 0;
+  size_t index = 0;
+
+  explicit NaiveWindow(size_t len) : values(len), length(len) {}
+
+  void push(int32_t v) {
+    values[index] = v;
+    index = (index + 1) % length;
+    if (count < length) count++;
+  }
+
+  int32_t range(int64_t &sum) const {
+    int32_t minV = values[0];
+    int32_t maxV = values[0];
+    sum = 0;
+    for (size_t i = 0; i < count; ++i) {
+      int32_t v = values[i];
+      if (v < minV) minV = v;
+      if (v > maxV) maxV = v;
+      sum += v;
+    }
+    return maxV - minV;
+  }
+};
+
+static void run(size_t length, const std::vector<int32_t> &trace) {
+  aiw::SlidingWindowStats<512> w(length);
+  NaiveWindow naive(length);
+  uint64_t checkFast = 0;
+  uint64_t checkNaive = 0;
+  size_t mismatches = 0;
+
+  auto t0 = std::chrono::steady_clock::now();
+  for (int32_t v : trace) {
+    w.push(v);
+    checkFast += (uint32_t)w.range() + (uint64_t)w.sum();
+  }
+  auto t1 = std::chrono::steady_clock::now();
+  for (int32_t v : trace) {
+    naive.push(v);
+    int64_t sum = 0;
+    checkNaive += (uint32_t)naive.range(sum) + (uint64_t)sum;
+  }
+  auto t2 = std::chrono::steady_clock::now();
+
+  w.reset();
+  NaiveWindow verify(length);
+  for (size_t i = 0; i < trace.size() && i < 200000; ++i) {
+    w.push(trace[i]);
+    verify.push(trace[i]);
+    int64_t sum = 0;
+    int32_t range = verify.range(sum);
+    if (range != w.range() || sum != w.sum()) mismatches++;
+  }
+
+  double n = (double)trace.size();
+  double fastNs = std::chrono::duration<double>(t1 - t0).count() * 1e9 / n;
+  double naiveNs = std::chrono::duration<double>(t2 - t1).count() * 1e9 / n;
+  printf("window=%-4zu sliding %7.2f ns/sample  rescan %8.2f ns/sample  mismatches=%zu%s\n", length, fastNs, naiveNs, mismatches, checkFast == checkNaive ? "" : " (checksum differs)");
+}
+
+int main(int argc, char **argv) {
+  size_t n = argc > 1 ? (size_t)strtoul(argv[1], nullptr, 10) : 1000000;
+  std::vector<int32_t> trace = makeTrace(n, 12345u);
+  const size_t lengths[] = {6, 16, 64, 128, 256, 512};
+  for (size_t len : lengths) run(len, trace);
+  return 0;
+}
@@ -0,0 +1,56 @@
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include <chrono>
+#include <vector>
+
+#include "app/weight_filter.h"
+
+static std::vector<int32_t> makeTrace(size_t n, uint32_t seed) {
+  std::vector<int32_t> out(n);
+  uint32_t s = seed;
+  int32_t level = 0;
+  for (size_t i = 0; i < n; ++i) {
+    s = s * 1664525u + 1013904223u;
+    if (i % 4000 == 0) level = (int32_t)((s >> 8) % 120000u);
+    int32_t noise = (int32_t)((s >> 16) % 161u) - 80;
+    out[i] = level + noise;
+  }
+  return out;
+}
+
+template <typename Filter>
+static void run(const char *name, const std::vector<int32_t> &trace, int rounds, uint16_t window = 0) {
+  aiw::WeightFilterConfig cfg = aiw::makeWeightFilterConfig(1000.0f, 0.1f, 0.15f, 0.3f);
+  if (window > 0) {
+    cfg.stabilityMode = aiw::StabilityMode::Window;
+    cfg.stableWindow = window;
+  }
+  Filter f(cfg);
+  uint64_t checksum = 0;
+  auto t0 = std::chrono::steady_clock::now();
+  for (int r = 0; r < rounds; ++r) {
+    f.reset();
+    for (int32_t v : trace) {
+      aiw::FilterOutput o = f.push(v);
+      checksum += (uint32_t)o.display + (o.locked ? 1u : 0u);
+    }
+  }
+  auto t1 = std::chrono::steady_clock::now();
+  double sec = std::chrono::duration<double>(t1 - t0).count();
+  double n = (double)trace.size() * rounds;
+  printf("%-24s %8.2f ns/sample %8.2f Msamples/s (checksum %llu)\n", name, sec * 1e9 / n, n / sec / 1e6, (unsigned long long)checksum);
+}
+
+int main(int argc, char **argv) {
+  size_t n = argc > 1 ? (size_t)strtoul(argv[1], nullptr, 10) : 1000000;
+  int rounds = argc > 2 ? atoi(argv[2]) : 5;
+  std::vector<int32_t> trace = makeTrace(n, 12345u);
+  run<aiw::WeightFilter<8, 8>>("WeightFilter<8,8>", trace, rounds);
+  run<aiw::WeightFilter<8, 12>>("WeightFilter<8,12>", trace, rounds);
+  run<aiw::WeightFilter<512, 8>>("WeightFilter<512,8>", trace, rounds);
+  run<aiw::WeightFilter<512, 8>>("WeightFilter<512,8> w=64", trace, rounds, 64);
+  run<aiw::WeightFilter<512, 8>>("WeightFilter<512,8> w=512", trace, rounds, 512);
+  return 0;
+}
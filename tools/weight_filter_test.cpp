@@ -0,0 +1,220 @@
+#include <math.h>
+#include <stdint.h>
+#include <stdio.h>
+
+#include "app/weight_filter.h"
+
+// Checks the fixed-point WeightFilter against the float display path it replaced in
+// main.cpp: 0.25 EMA, zero snap under 200 counts, 0.1 kg steps with 0.15 kg hysteresis,
+// lock after 6 stable samples and unlock beyond 0.3 kg. Scale is 1000 counts per kg.
+
+static int failures = 0;
+
+#define CHECK(cond, ...)                        \
+  do {                                          \
+    if (!(cond)) {                              \
+      printf("FAIL %s:%d: ", __FILE__, __LINE__); \
+      printf(__VA_ARGS__);                      \
+      printf("\n");                             \
+      failures++;                               \
+    }                                           \
+  } while (0)
+
+static constexpr float CountsPerKg = 1000.0f;
+
+// The pre-fixed-point loop body, minus the glitch reset (the traces below stay under it).
+struct FloatReference {
+  int stableHits = 0;
+  bool filteredInit = false;
+  float filteredDelta = 0.0f;
+  bool hasLastFilteredDelta = false;
+  int32_t lastFilteredDelta = 0;
+  bool displayLocked = false;
+  float lockedWeight = 0.0f;
+  bool hasLastShownWeight = false;
+  float lastShownWeight = 0.0f;
+  int hitsToLock = 6;
+  // Set when the unlock test compared exactly 0.3 kg, which float error decides either way.
+  bool unlockTie = false;
+
+  static float quantize(float v, float step) { return roundf(v / step) * step; }
+
+  // Returns the shown weight in 0.1 kg steps.
+  int32_t push(int32_t delta, bool &stable, int32_t &filtered) {
+    unlockTie = false;
+    if (!filteredInit) {
+      filteredDelta = (float)delta;
+      filteredInit = true;
+    } else {
+      filteredDelta = filteredDelta + 0.25f * ((float)delta - filteredDelta);
+    }
+    int32_t displayDelta = (int32_t)lroundf(filteredDelta);
+    filtered = displayDelta;
+    int32_t absDisplayDelta = displayDelta < 0 ? -displayDelta : displayDelta;
+    if (absDisplayDelta < 200) displayDelta = 0;
+    float quantizedWeight = quantize((float)displayDelta / CountsPerKg, 0.1f);
+    if (hasLastShownWeight && fabsf(quantizedWeight - lastShownWeight) < 0.15f) quantizedWeight = lastShownWeight;
+
+    bool stableNow = false;
+    if (hasLastFilteredDelta) {
+      int32_t diff = displayDelta - lastFilteredDelta;
+      if (diff < 0) diff = -diff;
+      int32_t threshold = 120 + absDisplayDelta / 500;
+      if (threshold > 500) threshold = 500;
+      stableNow = diff <= threshold;
+    }
+    hasLastFilteredDelta = true;
+    lastFilteredDelta = displayDelta;
+    if (stableNow) {
+      if (stableHits < 255) stableHits++;
+    } else {
+      stableHits = 0;
+    }
+    stable = stableHits >= hitsToLock;
+    float shownWeight = quantizedWeight;
+    if (stable) {
+      if (!displayLocked) {
+        displayLocked = true;
+        lockedWeight = quantizedWeight;
+      }
+      shownWeight = lockedWeight;
+    } else if (displayLocked) {
+      unlockTie = fabsf(fabsf(quantizedWeight - lockedWeight) - 0.3f) < 1e-4f;
+      if (fabsf(quantizedWeight - lockedWeight) > 0.3f) {
+        displayLocked = false;
+      } else {
+        shownWeight = lockedWeight;
+      }
+    }
+    hasLastShownWeight = true;
+    lastShownWeight = shownWeight;
+    return (int32_t)lroundf(shownWeight * 10.0f);
+  }
+};
+
+using Filter = aiw::WeightFilter<8, 8>;
+
+static aiw::WeightFilterConfig baselineConfig() {
+  return aiw::makeWeightFilterConfig(CountsPerKg, 0.1f, 0.15f, 0.3f);
+}
+
+static void testZeroSnap() {
+  Filter f(baselineConfig());
+  for (int i = 0; i < 20; ++i) {
+    aiw::FilterOutput o = f.push(199);
+    CHECK(o.display == 0, "199 counts shows %ld steps", (long)o.display);
+    o = f.push(-199);
+    CHECK(o.display == 0, "-199 counts shows %ld steps", (long)o.display);
+  }
+  f.reset();
+  aiw::FilterOutput o = f.push(200);
+  CHECK(o.display == 2, "200 counts shows %ld steps", (long)o.display);
+}
+
+static void testHysteresis() {
+  aiw::WeightFilterConfig cfg = baselineConfig();
+  cfg.stableHitsToLock = 255;
+  Filter f(cfg);
+  aiw::FilterOutput o{};
+  for (int i = 0; i < 30; ++i) o = f.push(1000);
+  CHECK(o.display == 10 && !o.locked, "1.0 kg shows %ld steps locked=%d", (long)o.display, o.locked);
+  // One step (0.1 kg) is inside the 0.15 kg band.
+  for (int i = 0; i < 30; ++i) o = f.push(1100);
+  CHECK(o.display == 10, "1.1 kg after 1.0 kg shows %ld steps", (long)o.display);
+  // Two steps are not.
+  for (int i = 0; i < 30; ++i) o = f.push(1200);
+  CHECK(o.display == 12, "1.2 kg after 1.0 kg shows %ld steps", (long)o.display);
+  for (int i = 0; i < 30; ++i) o = f.push(1100);
+  CHECK(o.display == 12, "1.1 kg after 1.2 kg shows %ld steps", (long)o.display);
+}
+
+static void testLock() {
+  Filter f(baselineConfig());
+  for (int i = 0; i < 10; ++i) {
+    aiw::FilterOutput o = f.push(5000);
+    // The first sample has nothing to compare with; hits 1..6 follow.
+    bool want = i >= 6;
+    CHECK(o.stable == want && o.locked == want, "sample %d stable=%d locked=%d", i, o.stable, o.locked);
+  }
+}
+
+static void testUnlock() {
+  Filter f(baselineConfig());
+  aiw::FilterOutput o{};
+  for (int i = 0; i < 10; ++i) o = f.push(5000);
+  CHECK(o.locked && o.display == 50, "locked=%d display=%ld", o.locked, (long)o.display);
+  // EMA 5250: unstable, 3 steps (0.3 kg) from the lock, so the lock holds.
+  o = f.push(6000);
+  CHECK(!o.stable && o.locked && o.display == 50, "first sample after jump stable=%d locked=%d display=%ld", o.stable, o.locked, (long)o.display);
+  // EMA 5437.5: 4 steps away, beyond 0.3 kg.
+  o = f.push(6000);
+  CHECK(!o.locked && o.display == 54, "second sample after jump locked=%d display=%ld", o.locked, (long)o.display);
+}
+
+// Slow ramps, plateaus and noise below the glitch threshold, compared sample by sample.
+// The Q8 EMA may round one count differently from the float EMA, so a display step may
+// only differ where the float value sits within a count of a zero-snap or step boundary,
+// or where the float unlock test met exactly 0.3 kg (the fixed path keeps such a lock).
+static void testAgainstFloat() {
+  Filter f(baselineConfig());
+  FloatReference ref;
+  uint32_t s = 987654321u;
+  int32_t level = 0;
+  int32_t target = 0;
+  int compared = 0;
+  int filteredOff = 0;
+  int boundary = 0;
+  for (int i = 0; i < 200000; ++i) {
+    s = s * 1664525u + 1013904223u;
+    if (i % 300 == 0) target = (int32_t)((s >> 8) % 150000u) - 20000;
+    int32_t move = target - level;
+    if (move > 150) move = 150;
+    if (move < -150) move = -150;
+    level += move;
+    int32_t noise = (int32_t)((s >> 20) % 241u) - 120;
+    int32_t sample = level + noise;
+
+    bool stable = false;
+    int32_t filtered = 0;
+    int32_t want = ref.push(sample, stable, filtered);
+    aiw::FilterOutput o = f.push(sample);
+    CHECK(!o.glitch && !o.step, "sample %d tripped the spike filter", i);
+    int32_t off = o.filtered - filtered;
+    if (off < 0) off = -off;
+    CHECK(off <= 1, "sample %d filtered %ld vs float %ld", i, (long)o.filtered, (long)filtered);
+    if (off != 0) filteredOff++;
+    if (off != 0 || o.stable != stable) {
+      // Diverged on a boundary; restart both so later samples are compared again.
+      f.reset();
+      ref = FloatReference();
+      continue;
+    }
+    if (o.display != want) {
+      float mag = fabsf(ref.filteredDelta);
+      float edge = fabsf(fmodf(mag, 100.0f) - 50.0f);
+      CHECK(ref.unlockTie || edge <= 1.0f || fabsf(mag - 200.0f) <= 1.0f, "sample %d display %ld vs float %ld at %.2f counts", i, (long)o.display, (long)want, ref.filteredDelta);
+      boundary++;
+      f.reset();
+      ref = FloatReference();
+      continue;
+    }
+    compared++;
+    if (failures > 20) return;
+  }
+  printf("float comparison: %d samples matched, %d one-count EMA roundings, %d boundary ties\n", compared, filteredOff, boundary);
+  CHECK(compared > 190000, "only %d samples compared", compared);
+}
+
+int main() {
+  testZeroSnap();
+  testHysteresis();
+  testLock();
+  testUnlock();
+  testAgainstFloat();
+  if (failures) {
+    printf("%d failures\n", failures);
+    return 1;
+  }
+  printf("weight_filter_test: ok\n");
+  return 0;
+}
@@ -0,0 +1,382 @@
+#include <math.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <algorithm>
+#include <vector>
+
+#include "app/noise_floor.h"
+#include "app/weigh_pipeline.h"
+#include "app/weigh_profile.h"
+#include "app/weight_filter.h"
+
+// Replays "cap,<t_us>,<raw>,<offset>,<scale>" lines captured with the serial 'C'
+// command through the same averaging, filter and pay-trigger code as loop().
+// --profile all runs every weighing profile over the traces and compares latency
+// against resolution.
+
+
+struct TraceSample {
+  uint64_t tUs;
+  int32_t raw;
+  int32_t offset;
+  float scale;
+};
+
+struct ReplayOptions {
+  aiw::WeighProfileId profile = aiw::WeighProfileId::Person;
+  // Without --profile the estimators only run when asked for, as before profiles.
+  bool profileEstimators = false;
+  // 0 allows two display steps of the profile.
+  float toleranceKg = 0.0f;
+  uint16_t stableWindow = 0;
+  int averageSamples = 0;
+  bool predict = false;
+  bool sway = false;
+  bool noise = false;
+  bool verbose = false;
+};
+
+struct Session {
+  uint64_t startMs = 0;
+  int64_t stableMs = -1;
+  int64_t triggerMs = -1;
+  float triggerKg = 0.0f;
+  bool falseTrigger = false;
+  int displayChanges = 0;
+  int32_t minDisplay = 0;
+  int32_t maxDisplay = 0;
+  float referenceKg = 0.0f;
+  // Filter output noise once the load has come to rest: the resolution the profile
+  // really delivers, next to its display step.
+  float noiseKg = -1.0f;
+};
+
+struct ReplayResult {
+  size_t samples = 0;
+  uint64_t durationMs = 0;
+  std::vector<Session> sessions;
+  int triggers = 0;
+  int falseTriggers = 0;
+  uint32_t glitches = 0;
+  uint32_t loadSteps = 0;
+  float noiseSigma = 0.0f;
+  int rateSps = 0;
+  int averageSamples = 0;
+  float stepKg = 0.0f;
+};
+
+static bool loadTrace(const char *path, std::vector<TraceSample> &out) {
+  FILE *f = fopen(path, "r");
+  if (!f) return false;
+  char line[256];
+  uint64_t base = 0;
+  uint32_t lastUs = 0;
+  bool hasLast = false;
+  while (fgets(line, sizeof(line), f)) {
+    const char *p = strstr(line, "cap,");
+    if (!p) continue;
+    unsigned long tUs = 0;
+    long raw = 0;
+    long offset = 0;
+    float scale = 0.0f;
+    if (sscanf(p, "cap,%lu,%ld,%ld,%f", &tUs, &raw, &offset, &scale) != 4) continue;
+    uint32_t t = (uint32_t)tUs;
+    if (hasLast && t < lastUs) base += (uint64_t)1 << 32;
+    hasLast = true;
+    lastUs = t;
+    out.push_back(TraceSample{base + t, (int32_t)raw, (int32_t)offset, scale});
+  }
+  fclose(f);
+  return true;
+}
+
+static float median(std::vector<float> v) {
+  if (v.empty()) return 0.0f;
+  std::sort(v.begin(), v.end());
+  return v[v.size() / 2];
+}
+
+// Steady-state output noise for the settled half of a session: the input sigma from
+// the MAD of first differences (immune to the slow settling tail), scaled by the EMA's
+// noise gain sqrt(a / (2 - a)).
+static float settledNoise(const std::vector<float> &v, int emaShift) {
+  if (v.size() < 8) return -1.0f;
+  std::vector<float> d;
+  for (size_t i = v.size() / 2 + 1; i < v.size(); ++i) d.push_back(fabsf(v[i] - v[i - 1]));
+  float sigma = median(d) / 0.954f;
+  float a = 1.0f / (float)(1 << emaShift);
+  return sigma * sqrtf(a / (2.0f - a));
+}
+
+static void closeSession(Session &s, std::vector<float> &deltasKg, ReplayResult &r, float toleranceKg, int emaShift) {
+  std::vector<float> settled(deltasKg.begin() + (long)(deltasKg.size() / 2), deltasKg.end());
+  s.referenceKg = median(settled);
+  s.noiseKg = settledNoise(deltasKg, emaShift);
+  if (s.triggerMs >= 0) {
+    float err = s.triggerKg - s.referenceKg;
+    if (err < 0) err = -err;
+    s.falseTrigger = err > toleranceKg;
+    if (s.falseTrigger) r.falseTriggers++;
+  }
+  r.sessions.push_back(s);
+  deltasKg.clear();
+}
+
+// Nominal HX711 rate of a trace, from its sample spacing.
+static int traceRateSps(const std::vector<TraceSample> &trace) {
+  if (trace.size() < 2) return 10;
+  uint64_t us = trace.back().tUs - trace.front().tUs;
+  if (us == 0) return 10;
+  float sps = (float)(trace.size() - 1) * 1e6f / (float)us;
+  return sps >= 40.0f ? 80 : 10;
+}
+
+// An 80 sps trace replayed as a 10 sps profile: average each group of 8 conversions,
+// which is roughly what the HX711's slower output filter does.
+static std::vector<TraceSample> decimate(const std::vector<TraceSample> &trace, int factor) {
+  std::vector<TraceSample> out;
+  out.reserve(trace.size() / factor + 1);
+  for (size_t i = 0; i + factor <= trace.size(); i += factor) {
+    int64_t sum = 0;
+    for (int k = 0; k < factor; ++k) sum += trace[i + k].raw;
+    TraceSample s = trace[i + factor - 1];
+    s.raw = (int32_t)(sum / factor);
+    out.push_back(s);
+  }
+  return out;
+}
+
+static ReplayResult replay(const std::vector<TraceSample> &input, const ReplayOptions &opt) {
+  ReplayResult r;
+  r.samples = input.size();
+  if (input.empty()) return r;
+  r.durationMs = (input.back().tUs - input.front().tUs) / 1000u;
+
+  const aiw::WeighProfile &profile = aiw::weighProfile(opt.profile);
+  int rate = traceRateSps(input);
+  std::vector<TraceSample> decimated;
+  if (profile.rateSps == 10 && rate == 80) {
+    decimated = decimate(input, 8);
+    rate = 10;
+  }
+  const std::vector<TraceSample> &trace = decimated.empty() ? input : decimated;
+  r.rateSps = rate;
+  r.stepKg = profile.stepKg;
+  float toleranceKg = opt.toleranceKg > 0.0f ? opt.toleranceKg : 2.0f * profile.stepKg;
+
+  float scale = trace.front().scale > 0.0f ? trace.front().scale : 1000.0f;
+  int avgCount = opt.averageSamples > 0 ? opt.averageSamples : aiw::weighProfileAverage(profile, rate);
+  r.averageSamples = avgCount;
+  aiw::WeightFilterConfig cfg = aiw::makeWeighProfileConfig(profile, scale, rate);
+  cfg.zeroSnapCounts = aiw::ZeroSnapDelta;
+  cfg.glitchCounts = aiw::GlitchDelta;
+  int32_t payTriggerCounts = aiw::PayTriggerDelta;
+  if (opt.noise) {
+    // Same estimator as the firmware, run over the whole trace up front.
+    aiw::NoiseFloorEstimator nf;
+    nf.configure(aiw::PayTriggerDelta / 2);
+    for (const TraceSample &s : trace) nf.push(s.raw - s.offset);
+    if (nf.ready()) {
+      r.noiseSigma = nf.sigma();
+      aiw::NoiseThresholds th = aiw::currentNoiseThresholds(nf, avgCount, scale, profile.stepKg);
+      aiw::applyFilterThresholds(cfg, th);
+      payTriggerCounts = th.payTriggerCounts;
+      if (opt.verbose) printf("  noise sigma=%.1f zero_snap=%ld stable_base=%ld stable_max=%ld pay_trigger=%ld glitch=%ld\n", nf.sigma(), (long)th.zeroSnapCounts, (long)th.stableBaseCounts, (long)th.stableMaxCounts, (long)th.payTriggerCounts, (long)th.glitchCounts);
+    }
+  }
+  if (opt.stableWindow > 0) {
+    cfg.stabilityMode = aiw::StabilityMode::Window;
+    cfg.stableWindow = opt.stableWindow;
+  }
+  if (!opt.profileEstimators) {
+    cfg.predictSettling = false;
+    cfg.swayDetect = false;
+  }
+  cfg.predictSettling = cfg.predictSettling || opt.predict;
+  cfg.swayDetect = cfg.swayDetect || opt.sway;
+  uint64_t spanMs = (trace.back().tUs - trace.front().tUs) / 1000u;
+  if (spanMs > 0) cfg.sampleRateHz = (float)(trace.size() - 1) * 1000.0f / (float)spanMs / (float)avgCount;
+  aiw::WeightFilter<aiw::StableWindowCapacity> filter(cfg);
+  aiw::SampleAverager averager(avgCount);
+  aiw::PayTrigger payTrigger;
+  payTrigger.configure(payTriggerCounts, profile.holdMs);
+
+  bool inSession = false;
+  bool paid = false;
+  bool hasShown = false;
+  int32_t lastShown = 0;
+  Session cur;
+  std::vector<float> deltasKg;
+  const uint64_t t0 = trace.front().tUs;
+
+  for (const TraceSample &s : trace) {
+    int32_t avg = 0;
+    if (!averager.push(s.raw, avg)) continue;
+    uint64_t nowMs = (s.tUs - t0) / 1000u;
+    int32_t delta = avg - s.offset;
+    aiw::FilterOutput fo = filter.push(delta);
+    int32_t absFiltered = fo.filtered < 0 ? -fo.filtered : fo.filtered;
+    bool onPlatform = absFiltered >= payTriggerCounts;
+
+    if (onPlatform && !inSession) {
+      inSession = true;
+      paid = false;
+      hasShown = false;
+      cur = Session{};
+      cur.startMs = nowMs;
+    } else if (!onPlatform && inSession) {
+      inSession = false;
+      closeSession(cur, deltasKg, r, toleranceKg, cfg.emaShift);
+    }
+    if (!inSession) {
+      payTrigger.reset();
+      continue;
+    }
+
+    deltasKg.push_back((float)delta / scale);
+    if (fo.stable && cur.stableMs < 0) cur.stableMs = (int64_t)(nowMs - cur.startMs);
+    if (cur.stableMs >= 0 && fo.locked) {
+      if (!hasShown) {
+        cur.minDisplay = fo.display;
+        cur.maxDisplay = fo.display;
+      } else if (fo.display != lastShown) {
+        cur.displayChanges++;
+      }
+      if (fo.display < cur.minDisplay) cur.minDisplay = fo.display;
+      if (fo.display > cur.maxDisplay) cur.maxDisplay = fo.display;
+      hasShown = true;
+      lastShown = fo.display;
+    }
+    if (!paid && payTrigger.update(fo, (uint32_t)nowMs)) {
+      paid = true;
+      r.triggers++;
+      cur.triggerMs = (int64_t)(nowMs - cur.startMs);
+      cur.triggerKg = (float)fo.display * profile.stepKg;
+      if (opt.verbose) printf("  trigger t=%llums weight=%.2f\n", (unsigned long long)nowMs, cur.triggerKg);
+    }
+  }
+  if (inSession) closeSession(cur, deltasKg, r, toleranceKg, cfg.emaShift);
+  r.glitches = filter.glitchCount();
+  r.loadSteps = filter.stepCount();
+  return r;
+}
+
+static void usage() {
+  fprintf(stderr, "usage: weight_replay [--profile name|all] [--tol kg] [--avg n] [--window n] [--predict] [--sway] [--noise] [-v] trace.log...\n");
+}
+
+struct ProfileSummary {
+  int rateSps = 0;
+  int averageSamples = 0;
+  float stableMs = 0.0f;
+  float triggerMs = 0.0f;
+  float noiseKg = 0.0f;
+  float errorKg = 0.0f;
+  int triggers = 0;
+  int falseTriggers = 0;
+  int untriggered = 0;
+};
+
+static ProfileSummary runTraces(const std::vector<const char *> &files, const ReplayOptions &opt, bool perTrace) {
+  ProfileSummary sum;
+  std::vector<float> stableTimes;
+  std::vector<float> triggerTimes;
+  std::vector<float> noise;
+  std::vector<float> errors;
+  if (perTrace) printf("%-28s %7s %8s %5s %9s %9s %5s %5s %7s %8s %6s %5s\n", "trace", "samples", "dur_ms", "steps", "stable_ms", "trig_ms", "trig", "false", "jitter", "p2p_kg", "spikes", "jumps");
+  for (const char *path : files) {
+    std::vector<TraceSample> trace;
+    if (!loadTrace(path, trace)) {
+      fprintf(stderr, "%s: cannot open\n", path);
+      continue;
+    }
+    ReplayResult r = replay(trace, opt);
+    sum.rateSps = r.rateSps;
+    sum.averageSamples = r.averageSamples;
+    const Session *first = r.sessions.empty() ? nullptr : &r.sessions.front();
+    int jitter = 0;
+    int32_t p2p = 0;
+    for (const Session &s : r.sessions) {
+      jitter += s.displayChanges;
+      if (s.maxDisplay - s.minDisplay > p2p) p2p = s.maxDisplay - s.minDisplay;
+      if (s.stableMs >= 0) stableTimes.push_back((float)s.stableMs);
+      if (s.triggerMs < 0) sum.untriggered++;
+      if (s.triggerMs >= 0) {
+        triggerTimes.push_back((float)s.triggerMs);
+        errors.push_back(fabsf(s.triggerKg - s.referenceKg));
+      }
+      if (s.noiseKg >= 0.0f) noise.push_back(s.noiseKg);
+    }
+    sum.triggers += r.triggers;
+    sum.falseTriggers += r.falseTriggers;
+    if (!perTrace) continue;
+    const char *name = strrchr(path, '/') ? strrchr(path, '/') + 1 : path;
+    printf("%-28s %7zu %8llu %5zu %9lld %9lld %5d %5d %7d %8.2f %6lu %5lu\n", name, r.samples, (unsigned long long)r.durationMs, r.sessions.size(), first ? (long long)first->stableMs : -1LL, first ? (long long)first->triggerMs : -1LL, r.triggers, r.falseTriggers, jitter, (float)p2p * r.stepKg, (unsigned long)r.glitches, (unsigned long)r.loadSteps);
+  }
+  sum.stableMs = median(stableTimes);
+  sum.triggerMs = median(triggerTimes);
+  sum.noiseKg = median(noise);
+  sum.errorKg = median(errors);
+  return sum;
+}
+
+int main(int argc, char **argv) {
+  ReplayOptions opt;
+  bool allProfiles = false;
+  std::vector<const char *> files;
+  for (int i = 1; i < argc; ++i) {
+    if (!strcmp(argv[i], "--profile") && i + 1 < argc) {
+      const char *name = argv[++i];
+      opt.profileEstimators = true;
+      if (!strcmp(name, "all")) {
+        allProfiles = true;
+      } else if (!aiw::weighProfileFromName(name, opt.profile)) {
+        fprintf(stderr, "unknown profile %s\n", name);
+        return 2;
+      }
+    } else if (!strcmp(argv[i], "--tol") && i + 1 < argc) {
+      opt.toleranceKg = (float)atof(argv[++i]);
+    } else if (!strcmp(argv[i], "--avg") && i + 1 < argc) {
+      opt.averageSamples = atoi(argv[++i]);
+    } else if (!strcmp(argv[i], "--window") && i + 1 < argc) {
+      opt.stableWindow = (uint16_t)atoi(argv[++i]);
+    } else if (!strcmp(argv[i], "--predict")) {
+      opt.predict = true;
+    } else if (!strcmp(argv[i], "--sway")) {
+      opt.sway = true;
+    } else if (!strcmp(argv[i], "--noise")) {
+      opt.noise = true;
+    } else if (!strcmp(argv[i], "-v")) {
+      opt.verbose = true;
+    } else if (argv[i][0] == '-') {
+      usage();
+      return 2;
+    } else {
+      files.push_back(argv[i]);
+    }
+  }
+  if (files.empty()) {
+    usage();
+    return 2;
+  }
+
+  if (!allProfiles) {
+    ProfileSummary s = runTraces(files, opt, true);
+    printf("median time-to-stable=%.0fms time-to-trigger=%.0fms triggers=%d false=%d untriggered=%d\n", s.stableMs, s.triggerMs, s.triggers, s.falseTriggers, s.untriggered);
+    return 0;
+  }
+
+  // Latency is the median time from step-on to stable and to the pay trigger; resolution
+  // is the display step next to the locked filter spread and the trigger error.
+  printf("%-10s %4s %4s %6s %7s %9s %9s %8s %8s %5s %5s %7s\n", "profile", "sps", "avg", "out_hz", "step_g", "stable_ms", "trig_ms", "noise_g", "error_g", "trig", "false", "untrig");
+  for (int i = 0; i < aiw::WeighProfileCount; ++i) {
+    opt.profile = (aiw::WeighProfileId)i;
+    const aiw::WeighProfile &p = aiw::weighProfile(opt.profile);
+    ProfileSummary s = runTraces(files, opt, opt.verbose);
+    printf("%-10s %4d %4d %6.1f %7.0f %9.0f %9.0f %8.1f %8.1f %5d %5d %7d\n", p.name, s.rateSps, s.averageSamples, s.averageSamples > 0 ? (float)s.rateSps / (float)s.averageSamples : 0.0f, p.stepKg * 1000.0f, s.stableMs, s.triggerMs, s.noiseKg * 1000.0f, s.errorKg * 1000.0f, s.triggers, s.falseTriggers, s.untriggered);
+  }
+  return 0;
+}